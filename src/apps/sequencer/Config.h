@@ -60,6 +60,9 @@
 #define CONFIG_FRACTAL_MAX_CELLS        128
 #define CONFIG_MODULATOR_COUNT          8
 
+// Engine
+#define CONFIG_ENGINE_COMMAND_QUEUE_SIZE 16
+
 
 // #define CONFIG_ENABLE_ASTEROIDS   // non-core easter-egg; gated off to reclaim ~19 KB flash
 // #define CONFIG_ENABLE_INTRO
@@ -20,6 +20,7 @@
 #include "os/os.h"
 
 #include "core/profiler/Profiler.h"
+#include "core/profiler/TaskTelemetry.h"
 #include "core/fs/Volume.h"
 
 #include "model/Model.h"
@@ -75,7 +76,7 @@ static SdCard sdCard;
 
 static fs::Volume volume(sdCard);
 
-static CCMRAM_BSS uint8_t midiMessagePayloadPool[32];
+static CCMRAM_BSS uint8_t midiMessagePayloadPool[96];
 
 static CCMRAM_BSS Profiler profiler;
 
@@ -104,7 +105,14 @@ static CCMRAM_BSS os::PeriodicTask<CONFIG_DRIVER_TASK_STACK_SIZE> driverTask("dr
     taskAlive(0);
 });
 
+#if CONFIG_ENABLE_TASK_PROFILER
+static CCMRAM_BSS os::ReleaseTimer engineRelease;
+#endif // CONFIG_ENABLE_TASK_PROFILER
+
 static CCMRAM_BSS os::PeriodicTask<CONFIG_ENGINE_TASK_STACK_SIZE> engineTask("engine", CONFIG_ENGINE_TASK_PRIORITY, os::time::ms(1), [] () {
+#if CONFIG_ENABLE_TASK_PROFILER
+    TaskTelemetry::recordRelease(engineRelease.release(os::time::ms(1)));
+#endif // CONFIG_ENABLE_TASK_PROFILER
     engine.update();
     taskAlive(1);
 });
@@ -125,12 +133,22 @@ static os::PeriodicTask<CONFIG_FILE_TASK_STACK_SIZE> fsTask("file", CONFIG_FILE_
 });
 
 #if CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER
-static CCMRAM_BSS os::PeriodicTask<CONFIG_PROFILER_TASK_STACK_SIZE> profilerTask("profiler", 0, os::time::ms(5000), [] () {
+static CCMRAM_BSS os::PeriodicTask<CONFIG_PROFILER_TASK_STACK_SIZE> profilerTask("profiler", CONFIG_PROFILER_TASK_PRIORITY, os::time::ms(TaskTelemetry::SampleInterval), [] () {
+    static int dumpCounter = 0;
+    bool dump = ++dumpCounter >= 5;
+    if (dump) {
+        dumpCounter = 0;
+    }
 #if CONFIG_ENABLE_PROFILER
-    profiler.dump();
+    if (dump) {
+        profiler.dump();
+    }
 #endif // CONFIG_ENABLE_PROFILE
 #if CONFIG_ENABLE_TASK_PROFILER
-    os::TaskProfiler::dump();
+    const auto &stats = TaskTelemetry::sample();
+    if (dump) {
+        TaskTelemetry::dump(stats);
+    }
 #endif // CONFIG_ENABLE_TASK_PROFILER
 });
 #endif // CONFIG_ENABLE_PROFILER || CONFIG_ENABLE_TASK_PROFILER
@@ -14,6 +14,7 @@
 #include "drivers/UsbH.h"
 
 #include "core/fs/Volume.h"
+#include "core/profiler/TaskTelemetry.h"
 
 #include "model/Model.h"
 #include "model/FileManager.h"
@@ -44,13 +45,19 @@ struct SequencerApp {
     // filesystem
     fs::Volume volume;
 
-    uint8_t midiMessagePayloadPool[32];
+    uint8_t midiMessagePayloadPool[96];
 
     // application
     Model model;
     Engine engine;
     Ui ui;
 
+    // task telemetry model (see os::TaskProfiler)
+    os::TaskProfiler::TaskInfo engineTaskInfo { "engine" };
+    os::TaskProfiler::TaskInfo uiTaskInfo { "ui" };
+    os::ReleaseTimer engineRelease;
+    uint32_t lastTelemetrySampleTicks = 0;
+
     SequencerApp() :
         volume(sdCard),
         engine(model, clockTimer, adc, dac, dio, gateOutput, midi, usbMidi, usbH),
@@ -66,7 +73,13 @@ struct SequencerApp {
     }
 
     void update() {
-        engine.update();
-        ui.update();
+        TaskTelemetry::recordRelease(engineRelease.release(os::time::ms(1)));
+        os::TaskProfiler::run(engineTaskInfo, [this] () { engine.update(); });
+        os::TaskProfiler::run(uiTaskInfo, [this] () { ui.update(); });
+
+        if (os::ticks() - lastTelemetrySampleTicks >= os::time::ms(TaskTelemetry::SampleInterval)) {
+            lastTelemetrySampleTicks = os::ticks();
+            TaskTelemetry::sample();
+        }
     }
 };
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "SortedQueue.h"
+#include "TimingWheel.h"
 
 #include "model/Arpeggiator.h"
 
@@ -24,6 +24,8 @@ public:
 
     void reset();
 
+    uint32_t eventQueueOverflows() const { return _eventQueue.overflows(); }
+
     void noteOn(int note);
     void noteOff(int note);
 
@@ -59,11 +61,5 @@ private:
     int8_t _noteCount;
     int8_t _noteHoldCount;
 
-    struct EventCompare {
-        bool operator()(const Event &a, const Event &b) {
-            return a.tick < b.tick;
-        }
-    };
-
-    SortedQueue<Event, 16, EventCompare> _eventQueue;
+    TimingWheel<Event, 16> _eventQueue;
 };
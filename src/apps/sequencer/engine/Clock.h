@@ -117,6 +117,8 @@ public:
     // Sequencer interface
     Event checkEvent();
     bool checkTick(uint32_t *tick);
+    // number of ticks waiting to be returned by checkTick()
+    uint32_t pendingTicks() const { return _tick - _tickProcessed; }
 
 private:
     enum class State {
@@ -2,7 +2,7 @@
 
 #include "TrackEngine.h"
 #include "SequenceState.h"
-#include "SortedQueue.h"
+#include "TimingWheel.h"
 #include "CurveRecorder.h"
 
 #include "generators/Latoocarfian.h"
@@ -35,6 +35,7 @@ public:
     virtual float sequenceProgress() const override {
         return _currentStep < 0 ? 0.f : float(_currentStep - _sequence->firstStep()) / (_sequence->lastStep() - _sequence->firstStep());
     }
+    virtual uint32_t eventQueueOverflows() const override { return _gateQueue.overflows(); }
 
     const CurveSequence &sequence() const { return *_sequence; }
     bool isActiveSequence(const CurveSequence &sequence) const { return &sequence == _sequence; }
@@ -109,11 +110,7 @@ private:
         bool gate;
     };
 
-    struct GateCompare {
-        bool operator()(const Gate &a, const Gate &b) {
-            return a.tick < b.tick;
-        }
-    };
-
-    SortedQueue<Gate, 16, GateCompare> _gateQueue;
+    TimingWheel<Gate, 16> _gateQueue;
 };
+
+static_assert(sizeof(CurveTrackEngine) <= 944, "CurveTrackEngine too large (TeletypeTrackEngine at 944 is the container limit)");
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CvFixed.h"
+
+#include "model/Calibration.h"
+
+#include <array>
+
+#include <cstdint>
+
+// Integer version of Calibration::CvOutput::voltsToValue(). Holds the DAC
+// value and the slope of each calibration segment, so mapping a fixed point
+// voltage to a DAC value is a lookup and one multiply. The table is rebuilt
+// when the calibration revision changes.
+class CvCalibrationLut {
+public:
+    using CalibrationCvOutput = Calibration::CvOutput;
+
+    static constexpr int ItemCount = CalibrationCvOutput::ItemCount;
+    static constexpr int ItemsPerVolt = CalibrationCvOutput::ItemsPerVolt;
+
+    // rebuild the table if the calibration changed, returns true if it was rebuilt
+    bool update(const CalibrationCvOutput &calibration) {
+        if (_valid && calibration.revision() == _revision) {
+            return false;
+        }
+        for (int i = 0; i < ItemCount; ++i) {
+            _values[i] = calibration.item(i);
+        }
+        for (int i = 0; i < ItemCount - 1; ++i) {
+            _slopes[i] = int32_t(_values[i + 1]) - int32_t(_values[i]);
+        }
+        _slopes[ItemCount - 1] = 0;
+        _revision = calibration.revision();
+        _valid = true;
+        return true;
+    }
+
+    uint16_t value(CvFixed::Value volts) const {
+        static constexpr CvFixed::Value Min = CvFixed::fromInt(CalibrationCvOutput::MinVoltage);
+        static constexpr CvFixed::Value Max = CvFixed::fromInt(CalibrationCvOutput::MaxVoltage);
+
+        // position in items as Q16.16
+        uint32_t position = uint32_t(clamp(volts, Min, Max) - Min) * ItemsPerVolt;
+        int index = position >> CvFixed::FracBits;
+        int32_t t = position & (CvFixed::One - 1);
+        // arithmetic shift floors like the float to integer conversion of the float version
+        return uint16_t(_values[index] + int32_t((int64_t(t) * _slopes[index]) >> CvFixed::FracBits));
+    }
+
+private:
+    std::array<uint16_t, ItemCount> _values;
+    std::array<int32_t, ItemCount> _slopes;
+    uint32_t _revision = 0;
+    bool _valid = false;
+};
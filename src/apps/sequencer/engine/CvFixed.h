@@ -0,0 +1,31 @@
+#pragma once
+
+#include "core/math/Math.h"
+
+#include <cstdint>
+
+// Fixed point CV representation in Q16.16 volts, used by the CV calibration table.
+// The resolution (~15uV) is well below a DAC LSB (~0.3mV) and the range covers
+// any voltage the engine produces, so converting from float only rounds.
+namespace CvFixed {
+
+    using Value = int32_t;
+
+    static constexpr int FracBits = 16;
+    static constexpr Value One = Value(1) << FracBits;
+    static constexpr float Limit = 32767.f;
+
+    static inline Value fromVolts(float volts) {
+        volts = clamp(volts, -Limit, Limit) * One;
+        return Value(volts < 0.f ? volts - 0.5f : volts + 0.5f);
+    }
+
+    static inline float toVolts(Value value) {
+        return value * (1.f / One);
+    }
+
+    static constexpr Value fromInt(int volts) {
+        return Value(volts) * One;
+    }
+
+} // namespace CvFixed
@@ -13,7 +13,9 @@ void CvOutput::init() {
 
 void CvOutput::update() {
     for (int i = 0; i < Channels; ++i) {
-        _dac.setValue(i, _calibration.cvOutput(i).voltsToValue(_channels[i]));
+        auto &calibrationLut = _calibrationLuts[i];
+        calibrationLut.update(_calibration.cvOutput(i));
+        _dac.setValue(i, calibrationLut.value(CvFixed::fromVolts(_channels[i])));
     }
     _dac.write();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Config.h"
+#include "CvCalibrationLut.h"
 
 #include "model/Calibration.h"
 
@@ -26,8 +27,12 @@ public:
         _channels[index] = value;
     }
 
+    // time the dac last updated its outputs in us
+    uint32_t updateUs() const { return _dac.updateUs(); }
+
 private:
     Dac &_dac;
     const Calibration &_calibration;
     std::array<float, Channels> _channels;
+    std::array<CvCalibrationLut, Channels> _calibrationLuts;
 };
@@ -2,14 +2,17 @@
 
 #include "Config.h"
 #include "MidiUtils.h"
-#include "GateRotation.h"
-#include "Tt2OutputMix.h"
+#include "TrackEngineDispatch.h"
 
 #include "core/Debug.h"
 #include "core/midi/MidiMessage.h"
+#include "core/profiler/TaskTelemetry.h"
 
 #include "os/os.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include <cmath>
 
 Engine::Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &dio, GateOutput &gateOutput, Midi &midi, UsbMidi &usbMidi, UsbH &usbH) :
@@ -29,6 +32,7 @@ Engine::Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &di
     _cvOutputOverrideValues.fill(0.f);
     _cvRouteOutputs.fill(0.f);
     _trackEngines.fill(nullptr);
+    _trackNextTick.fill(0);
     _busCv.fill(0.f);
 
     _usbMidi.setConnectHandler([this] (uint16_t vendorId, uint16_t productId) { usbMidiConnect(vendorId, productId); });
@@ -77,14 +81,9 @@ void Engine::update() {
 }
 
 void Engine::updateImpl() {
-    // locking
-    _locked = _requestLock;
-    if (_locked) {
-        return;
-    }
-
     uint32_t nowUs = _wallClock.now();
-    float dt = (nowUs - _lastWallUs) * 1e-6f; // seconds of real wall time (wrap-safe delta)
+    uint32_t intervalUs = nowUs - _lastWallUs; // wrap-safe delta
+    float dt = intervalUs * 1e-6f; // seconds of real wall time
     _lastWallUs = nowUs;
 
     // suspending
@@ -106,16 +105,22 @@ void Engine::updateImpl() {
         while (_midi.recv(&message)) {}
         while (_usbMidi.recv(&cable, &message)) {}
 
+        // keep applying commands, producers may be waiting for them
+        _commandQueue.apply();
+
         _cvInput.update();
         _busCvWritten.fill(false);
         _busCvWriters.fill(0);   // re-seed bus sum each frame (CV-router writes below)
         _busCvRouting.fill(0.f); // suspended: no routing compose, so drop its slot
         updateOverrides();       // clears + refills the CV-router slot
-        _cvOutput.update();
-        _gateOutput.update();
+        commitOutputs();
         return;
     }
 
+    // apply commands from other tasks before engine containers are rebuilt,
+    // so track mode changes take effect within the same frame
+    _commandQueue.apply();
+
     // rebuild engine containers for any tracks whose mode changed
     // (must precede clock-event processing — Reset/Start call Engine::reset()
     //  which iterates _trackEngines[] and would deref stale pointers if the
@@ -180,8 +185,58 @@ void Engine::updateImpl() {
     _busCvRouting.fill(0.f);   // re-seed routing's bus contribution each compose
     _routingEngine.update();
 
+    // query when track engines have to run next, the model may have changed since the last tick
+    for (size_t trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        _trackNextTick[trackIndex] = trackEngineNextTick(trackIndex, _tick + 1);
+    }
+
+    // Modulators advance in batches of ticks with a constant gate and are only evaluated when
+    // sampled: on a gate change, before routing composes and at the end of the frame. Geode reads
+    // M1/M2 and Teletype scripts read modulators on every tick, so either disables batching.
+    // Modulators feeding a fractal track source or gating other modulators are sampled on every tick.
+    bool batchModulators = true;
+    uint32_t sampledModulators = 0;
+    for (size_t trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        const auto &track = _project.track(trackIndex);
+        auto trackMode = track.trackMode();
+        if (trackMode == Track::TrackMode::TeletypeV2 || trackMode == Track::TrackMode::TeletypeMini) {
+            batchModulators = false;
+        }
+        if (trackMode == Track::TrackMode::Fractal) {
+            const auto &fractalTrack = track.fractalTrack();
+            for (int source : { fractalTrack.sourceA(), fractalTrack.sourceB() }) {
+                if (FractalTrack::sourceKind(source) != FractalTrack::SourceKind::Channel) {
+                    continue;
+                }
+                Routing::Source channel = FractalTrack::sourceChannelOf(source);
+                if (Routing::isModulatorSource(channel)) {
+                    sampledModulators |= 1 << Routing::modulatorSourceIndex(channel);
+                }
+            }
+        }
+    }
+    for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
+        Routing::Source gateSource = _project.modulator(modulatorIndex).gateSource();
+        if (Routing::isModulatorSource(gateSource)) {
+            sampledModulators |= 1 << Routing::modulatorSourceIndex(gateSource);
+        }
+    }
+
+    // ticks queue up in the clock if the engine task was released late, the catch-up
+    // policy decides how many of them are processed in this frame
+    uint32_t pendingTicks = _clock.pendingTicks();
+    uint32_t tickLimit = _tickCatchUp.begin(pendingTicks, intervalUs, UpdatePeriodUs);
+    TaskTelemetry::recordTickBacklog(pendingTicks);
+    bool cvUpdatedCollapsed = false;
+
     uint32_t tick;
-    while (_clock.checkTick(&tick)) {
+    while (tickLimit > 0 && _clock.checkTick(&tick)) {
+        --tickLimit;
+
+        // dispatch all tracks if the tick does not continue from the last one
+        if (tick != _tick + 1) {
+            _trackNextTick.fill(0);
+        }
         _tick = tick;
         ++_updateTicks;
 
@@ -192,11 +247,10 @@ void Engine::updateImpl() {
         bool cvUpdated = false;
         for (size_t trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
             auto &track = _model.project().track(trackIndex);
-            auto &trackEngine = *_trackEngines[trackIndex];
 
             TrackEngine::TickResult result = TrackEngine::TickResult::NoUpdate;
-            if (track.runGate()) {
-                result = trackEngine.tick(tick);
+            if (track.runGate() && tick >= _trackNextTick[trackIndex]) {
+                result = tickTrackEngine(trackIndex, tick);
             }
             if (result & TrackEngine::TickResult::CvUpdate) {
                 cvUpdated = true;
@@ -221,9 +275,6 @@ void Engine::updateImpl() {
                 }
             }
         }
-        const bool justf = !geodeActive && _modulatorEngine.justfActive();
-        const float justfMasterHz = justf ? _project.modulator(0).rateHz() : 0.f;
-        const float justfIntone = _modulatorEngine.intone();
         for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
             const auto &modulator = _project.modulator(modulatorIndex);
             Routing::Source gs = modulator.gateSource();
@@ -256,15 +307,14 @@ void Engine::updateImpl() {
                 continue;
             }
 
-            // JustF: Free-domain modulators run at M1 x INTONE-ratio (B-clamped); others as-is.
-            float rateOverride = -1.f;
-            const Modulator *envBase = nullptr;
-            if (justf && modulator.rateDomain() == Modulator::RateDomain::Free) {
-                rateOverride = ModulatorEngine::justfEffectiveHz(justfMasterHz, justfIntone, modulatorIndex + 1);
-                envBase = &_project.modulator(0);   // ADSR inherits M1's envelope, spread by index
+            if (_modulatorPendingTicks[modulatorIndex] > 0 && _modulatorPendingGate[modulatorIndex] != gate) {
+                flushModulator(modulatorIndex, dt);
+            }
+            _modulatorPendingGate[modulatorIndex] = gate;
+            ++_modulatorPendingTicks[modulatorIndex];
+            if (!batchModulators || geodeActive || (sampledModulators & (1 << modulatorIndex))) {
+                flushModulator(modulatorIndex, dt);
             }
-            _modulatorEngine.tick(tick, dt, modulator, modulatorIndex, gate, rateOverride, envBase);
-            _midiOutputEngine.sendModulator(modulatorIndex, _modulatorEngine.currentValue(modulatorIndex));
         }
 
         // Geode driver: M1's phase clocks the engine, M2's output is RUN, globals come from
@@ -284,6 +334,14 @@ void Engine::updateImpl() {
             }
         }
 
+        // collapse: more ticks of this frame follow, so only the last one recomputes
+        if (_tickCatchUp.collapse(tickLimit)) {
+            cvUpdatedCollapsed |= cvUpdated;
+            continue;
+        }
+        cvUpdated |= cvUpdatedCollapsed;
+        cvUpdatedCollapsed = false;
+
         // single per-tick global recompute (was run once per firing track, T×
         // redundant). The reducer remains a rate-limit safety cap.
         // Compose physical outputs first so routing sources that read CvOut/GateOut
@@ -291,9 +349,8 @@ void Engine::updateImpl() {
         // and recompose so CV-route output channels are current-tick (not one
         // update stale). The double compose breaks the routing<->CV-route cycle.
         if (cvUpdated && _updateReducer.update()) {
-            for (auto trackEngine : _trackEngines) {
-                trackEngine->update(0.f);
-            }
+            flushModulators(dt);
+            updateTrackEngines(0.f);
             updateTrackOutputs();
             _busCvRouting.fill(0.f);
             _routingEngine.update();
@@ -302,9 +359,11 @@ void Engine::updateImpl() {
         }
     }
 
-    for (auto trackEngine : _trackEngines) {
-        trackEngine->update(dt);
-    }
+    flushModulators(dt);
+
+    preparePatterns();
+
+    updateTrackEngines(dt);
 
     _midiOutputEngine.update();
 
@@ -314,8 +373,18 @@ void Engine::updateImpl() {
     applyBusSafety();
 
     // update cv/gate outputs
+    commitOutputs();
+
+    publishSnapshot();
+}
+
+void Engine::commitOutputs() {
+    // the dac updates all channels with the last write of the frame, the gates are
+    // latched right after, so gate edges reach the jacks together with their cv
     _cvOutput.update();
     _gateOutput.update();
+    // a gate latched before the dac update wraps around to a huge skew
+    TaskTelemetry::recordOutputSkew(_gateOutput.latchUs() - _cvOutput.updateUs());
 }
 
 void Engine::updateBusSafetyMode() {
@@ -333,22 +402,10 @@ void Engine::applyBusSafety() {
     }
 }
 
-void Engine::lock() {
-    while (!isLocked()) {
-        _requestLock = 1;
-#ifdef PLATFORM_SIM
-        update();
-#endif
-    }
-}
-
-void Engine::unlock() {
-    while (isLocked()) {
-        _requestLock = 0;
+void Engine::waitForCommands() {
 #ifdef PLATFORM_SIM
-        update();
+    update();
 #endif
-    }
 }
 
 void Engine::suspend() {
@@ -557,7 +614,9 @@ Engine::Stats Engine::stats() const {
     return {
         .uptime = os::ticks() / os::time::ms(1000),
         .midiRxOverflow = _midi.rxOverflow(),
-        .usbMidiRxOverflow = _usbMidi.rxOverflow()
+        .usbMidiRxOverflow = _usbMidi.rxOverflow(),
+        .usbMidiTxOverflow = _usbMidi.txOverflow(),
+        .usbMidiTxQueueHighWater = _usbMidi.txQueueHighWater()
     };
 }
 
@@ -587,6 +646,127 @@ void Engine::onClockMidi(uint8_t data) {
     }
 }
 
+namespace {
+
+// Visitors for the per-tick track engine calls (see TrackEngineDispatch.h).
+
+struct TickVisitor {
+    uint32_t tick;
+    TrackEngine::TickResult result;
+    uint32_t nextTick;
+    template<typename T> void operator()(T &trackEngine) {
+        result = trackEngine.tick(tick);
+        nextTick = trackEngine.nextTick(tick + 1);
+    }
+};
+
+struct NextTickVisitor {
+    uint32_t tick;
+    uint32_t nextTick;
+    template<typename T> void operator()(T &trackEngine) { nextTick = trackEngine.nextTick(tick); }
+};
+
+struct UpdateVisitor {
+    float dt;
+    template<typename T> void operator()(T &trackEngine) { trackEngine.update(dt); }
+};
+
+struct GateOutputVisitor {
+    int index;
+    bool gate;
+    template<typename T> void operator()(T &trackEngine) { gate = trackEngine.gateOutput(index); }
+};
+
+struct CvOutputVisitor {
+    int index;
+    float cv;
+    template<typename T> void operator()(T &trackEngine) { cv = trackEngine.cvOutput(index); }
+};
+
+// step position of engines that have one, -1 otherwise
+template<typename T>
+auto snapshotCurrentStep(const T &trackEngine, int) -> decltype(int(trackEngine.currentStep())) {
+    return trackEngine.currentStep();
+}
+
+template<typename T>
+int snapshotCurrentStep(const T &trackEngine, long) {
+    return -1;
+}
+
+struct SnapshotVisitor {
+    EngineSnapshot::TrackState &state;
+    template<typename T> void operator()(const T &trackEngine) {
+        state.currentStep = snapshotCurrentStep(trackEngine, 0);
+        state.activity = trackEngine.activity();
+        state.sequenceProgress = trackEngine.sequenceProgress();
+    }
+};
+
+} // namespace
+
+TrackEngine::TickResult Engine::tickTrackEngine(int trackIndex, uint32_t tick) {
+    TickVisitor visitor{ tick, TrackEngine::TickResult::NoUpdate, 0 };
+    visitTrackEngine(_trackEngineModes[trackIndex], *_trackEngines[trackIndex], visitor);
+    _trackNextTick[trackIndex] = visitor.nextTick;
+    return visitor.result;
+}
+
+uint32_t Engine::trackEngineNextTick(int trackIndex, uint32_t tick) const {
+    NextTickVisitor visitor{ tick, tick };
+    visitTrackEngine(_trackEngineModes[trackIndex], *_trackEngines[trackIndex], visitor);
+    return visitor.nextTick;
+}
+
+void Engine::updateTrackEngines(float dt) {
+    UpdateVisitor visitor{ dt };
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        visitTrackEngine(_trackEngineModes[trackIndex], *_trackEngines[trackIndex], visitor);
+    }
+}
+
+bool Engine::trackEngineGateOutput(int trackIndex, int index) const {
+    GateOutputVisitor visitor{ index, false };
+    visitTrackEngine(_trackEngineModes[trackIndex], *_trackEngines[trackIndex], visitor);
+    return visitor.gate;
+}
+
+float Engine::trackEngineCvOutput(int trackIndex, int index) const {
+    CvOutputVisitor visitor{ index, 0.f };
+    visitTrackEngine(_trackEngineModes[trackIndex], *_trackEngines[trackIndex], visitor);
+    return visitor.cv;
+}
+
+void Engine::publishSnapshot() {
+    auto &snapshot = _snapshots.write();
+    snapshot.gateOutput = _gateOutput.gates();
+    for (int channel = 0; channel < CvOutput::Channels; ++channel) {
+        snapshot.cvOutput[channel] = _cvOutput.channel(channel);
+    }
+
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        auto trackMode = _trackEngineModes[trackIndex];
+        auto &state = snapshot.tracks[trackIndex];
+        state.trackMode = trackMode;
+        const auto &trackEngine = *_trackEngines[trackIndex];
+        SnapshotVisitor visitor{ state };
+        visitTrackEngine(trackMode, trackEngine, visitor);
+        state.mute = trackEngine.mute();
+        state.fill = trackEngine.fill();
+    }
+
+    for (int index = 0; index < BusCvCount; ++index) {
+        snapshot.busCv[index] = busCv(index);
+        snapshot.busWriters[index] = _busCvWriters[index];
+    }
+
+    for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
+        snapshot.modulatorValues[modulatorIndex] = _modulatorEngine.currentValue(modulatorIndex);
+    }
+
+    _snapshots.publish();
+}
+
 void Engine::updateTrackSetups() {
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
         auto &track = _project.track(trackIndex);
@@ -632,150 +812,60 @@ void Engine::updateTrackSetups() {
             case Track::TrackMode::Last:
                 break;
             }
+            _trackEngineModes[trackIndex] = track.trackMode();
         }
     }
 }
 
-void Engine::updateTrackOutputs() {
-    const auto &gateOutputTracks = _project.gateOutputTracks();
-    const auto &cvOutputTracks = _project.cvOutputTracks();
+// Output values for TrackOutputComposer.
+struct Engine::TrackOutputSource {
+    const Engine &engine;
 
-    // TT2 tracks emit to jacks only via the auto-index layer below; they are
-    // excluded from the legacy Layout source path and the rotation pools.
-    bool isTt2[CONFIG_TRACK_COUNT];
-    bool anyTt2 = false;
-    for (int t = 0; t < CONFIG_TRACK_COUNT; ++t) {
-        auto mode = _project.track(t).trackMode();
-        isTt2[t] = (mode == Track::TrackMode::TeletypeV2 || mode == Track::TrackMode::TeletypeMini);
-        anyTt2 = anyTt2 || isTt2[t];
-    }
+    bool gate(int trackIndex, int index) const { return engine.trackEngineGateOutput(trackIndex, index); }
+    float cv(int trackIndex, int index) const { return engine.trackEngineCvOutput(trackIndex, index); }
+    float cvRoute(int lane) const { return engine._cvRouteOutputs[lane]; }
+    float applyModulatorOffset(int channel, float cvValue) const { return engine.applyModulatorOffset(channel, cvValue); }
+};
 
-    int trackGateIndex[CONFIG_TRACK_COUNT];
-    int trackCvIndex[CONFIG_TRACK_COUNT];
-    int cvOutputTrackIndex[CONFIG_CHANNEL_COUNT];
-    int cvOutputTrackSlot[CONFIG_CHANNEL_COUNT];
-    int cvOutputCvRouteLane[CONFIG_CHANNEL_COUNT];
+void Engine::updateTrackOutputs() {
+    static_assert(TrackOutputComposer::CvRouteLanes == CvRoute::LaneCount, "CV route lane count mismatch");
 
-    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        trackGateIndex[trackIndex] = 0;
-        trackCvIndex[trackIndex] = 0;
-    }
+    // TT2 tracks emit to jacks only via the auto-index layer of the composer; they are
+    // excluded from the legacy Layout source path and the rotation pools (spec 018/019).
+    TrackOutputComposer::Mapping mapping;
+    const auto &gateOutputTracks = _project.gateOutputTracks();
+    const auto &cvOutputTracks = _project.cvOutputTracks();
     for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
-        cvOutputTrackIndex[i] = -1;
-        cvOutputTrackSlot[i] = -1;
-        cvOutputCvRouteLane[i] = -1;
+        mapping.gateOutputTracks[i] = gateOutputTracks[i];
+        mapping.cvOutputTracks[i] = cvOutputTracks[i];
     }
-
-    // --- Gate Rotation Logic ---
-    int gatePool[CONFIG_CHANNEL_COUNT];
-    int gatePoolSize = 0;
-
-    // Identify Gate Pool: jacks whose track is in the rotation group (spec 018 — the
-    // GateOutputRotate route's mask), not the legacy per-track isGateOutputRotated().
-    uint8_t gateRotateMask = _routingEngine.gateRotateMask();
-    for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
-        int trackIndex = gateOutputTracks[i];
-        if (trackIndex < CONFIG_TRACK_COUNT &&
-            !isTt2[trackIndex] &&
-            (gateRotateMask & (1 << trackIndex))) {
-            gatePool[gatePoolSize++] = i;
+    mapping.tt2Tracks = 0;
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        auto mode = _project.track(trackIndex).trackMode();
+        if (mode == Track::TrackMode::TeletypeV2 || mode == Track::TrackMode::TeletypeMini) {
+            mapping.tt2Tracks |= 1 << trackIndex;
         }
     }
+    mapping.gateRotateMask = _routingEngine.gateRotateMask();
+    mapping.gateRotateAmount = _routingEngine.gateRotateAmount();
+    mapping.cvRotateMask = _routingEngine.cvRotateMask();
+    mapping.cvRotateAmount = _routingEngine.cvRotateAmount();
+    _trackOutputComposer.setMapping(mapping);
 
-    // --- CV Rotation Logic ---
-    int cvPool[CONFIG_CHANNEL_COUNT];
-    int cvPoolSize = 0;
-
-    // Identify CV Pool: jacks whose track is in the CV rotation group (spec 019 — the
-    // CvOutputRotate route's mask).
-    uint8_t cvRotateMask = _routingEngine.cvRotateMask();
-    for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
-        int trackIndex = cvOutputTracks[i];
-        if (trackIndex < CONFIG_TRACK_COUNT &&
-            !isTt2[trackIndex] &&
-            (cvRotateMask & (1 << trackIndex))) {
-            cvPool[cvPoolSize++] = i;
-        }
-    }
+    TrackOutputSource source = { *this };
 
-    // Precompute CV output track slots and CV route lanes
-    int cvRouteLane = 0;
-    for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
-        int trackIndex = cvOutputTracks[i];
-        if (trackIndex < CONFIG_TRACK_COUNT) {
-            cvOutputTrackIndex[i] = trackIndex;
-            cvOutputTrackSlot[i] = trackCvIndex[trackIndex]++;
-        } else if (trackIndex == CONFIG_TRACK_COUNT) {
-            cvOutputCvRouteLane[i] = cvRouteLane++;
-        }
+    if (!_gateOutputOverride) {
+        _gateOutput.setGates(_trackOutputComposer.composeGates(source, _gateOutput.gates()));
     }
 
-    for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
-        // Gate Output
-        int gateSourceOutputIndex = i;
-        // Check if this output is in the pool
-        int gatePoolIndex = -1;
-        for (int k = 0; k < gatePoolSize; ++k) { if (gatePool[k] == i) { gatePoolIndex = k; break; } }
-
-        if (gatePoolIndex != -1) {
-            // One group amount rotates the whole pool (legacy (p - N) mod K cycle).
-            int rotatedIndex = rotatedGroupMember(gatePoolIndex, _routingEngine.gateRotateAmount(), gatePoolSize);
-            gateSourceOutputIndex = gatePool[rotatedIndex];
-        }
-
-        int gateOutputTrack = gateOutputTracks[gateSourceOutputIndex];
-        if (!_gateOutputOverride && gateOutputTrack < CONFIG_TRACK_COUNT) {
-            // Legacy gate skips a TT2 source (resolves false); TT2 reaches the jack
-            // only via the OR layer below, fixed to physical gate jack index.
-            bool g = isTt2[gateOutputTrack] ? false
-                : _trackEngines[gateOutputTrack]->gateOutput(trackGateIndex[gateOutputTrack]++);
-            bool gateAtJack[CONFIG_TRACK_COUNT];
-            for (int t = 0; t < CONFIG_TRACK_COUNT; ++t)
-                gateAtJack[t] = isTt2[t] ? _trackEngines[t]->gateOutput(i) : false;
-            g = g || Tt2OutputMix::anyGate(gateAtJack, isTt2, CONFIG_TRACK_COUNT);
-            _gateOutput.setGate(i, g);
+    if (!_cvOutputOverride) {
+        float cv[CONFIG_CHANNEL_COUNT];
+        for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
+            cv[i] = _cvOutput.channel(i);
         }
-
-        // CV Output
-        int cvSourceOutputIndex = i;
-        // Check if this output is in the pool
-        int cvPoolIndex = -1;
-        for (int k = 0; k < cvPoolSize; ++k) { if (cvPool[k] == i) { cvPoolIndex = k; break; } }
-
-        if (cvPoolIndex != -1) {
-            // One group amount rotates the whole pool (discrete, mirror of gate; spec 019).
-            int rotatedIndex = rotatedGroupMember(cvPoolIndex, _routingEngine.cvRotateAmount(), cvPoolSize);
-            cvSourceOutputIndex = cvPool[rotatedIndex];
-        }
-
-        int cvOutputTrack = cvOutputTracks[cvSourceOutputIndex];
-        if (_cvOutputOverride) {
-            continue;
-        }
-        // Legacy base (modulator-offset applied): a TT2-assigned jack resolves to 0
-        // here, then receives its TT2 value through the auto-index layer below.
-        float cvBase = 0.f;
-        bool writeJack = anyTt2;
-        if (cvOutputTrack < CONFIG_TRACK_COUNT) {
-            if (!isTt2[cvOutputTrack]) {
-                int cvSlot = cvOutputTrackSlot[cvSourceOutputIndex];
-                cvBase = _trackEngines[cvOutputTrack]->cvOutput(cvSlot);
-            }
-            writeJack = true;
-        } else if (cvOutputTrack == CONFIG_TRACK_COUNT) {
-            int lane = cvOutputCvRouteLane[cvSourceOutputIndex];
-            if (lane >= 0 && lane < int(_cvRouteOutputs.size())) {
-                cvBase = _cvRouteOutputs[lane];
-                writeJack = true;
-            }
-        }
-        if (writeJack) {
-            float v = applyModulatorOffset(i, cvBase);
-            float cvAtJack[CONFIG_TRACK_COUNT];
-            for (int t = 0; t < CONFIG_TRACK_COUNT; ++t)
-                cvAtJack[t] = isTt2[t] ? _trackEngines[t]->cvOutput(i) : 0.f;
-            v = clamp(v + Tt2OutputMix::sumCv(cvAtJack, isTt2, CONFIG_TRACK_COUNT), -5.f, 5.f);
-            _cvOutput.setChannel(i, v);
+        _trackOutputComposer.composeCv(source, cv);
+        for (int i = 0; i < CONFIG_CHANNEL_COUNT; ++i) {
+            _cvOutput.setChannel(i, cv[i]);
         }
     }
 }
@@ -886,9 +976,13 @@ void Engine::reset() {
     for (auto trackEngine : _trackEngines) {
         trackEngine->reset();
     }
+    _trackNextTick.fill(0);
 
     _midiOutputEngine.reset();
     _modulatorEngine.reset();
+    for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
+        _modulatorPendingTicks[modulatorIndex] = 0;
+    }
     _geodeEngine.reset();
 }
 
@@ -1083,6 +1177,67 @@ void Engine::updatePlayState(bool ticked) {
         for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
             _trackEngines[trackIndex]->changePattern();
         }
+        _trackNextTick.fill(0);
+    }
+}
+
+// Look ahead at pending pattern requests and the next song slot and let one
+// track per update prepare the pattern it switches to, so the switch itself
+// does not pay for rebuilding derived pattern state on the downbeat.
+void Engine::preparePatterns() {
+    const auto &playState = _project.playState();
+    const auto &songState = playState.songState();
+    const auto &song = _project.song();
+
+    int nextSlot = -1;
+    if (songState.hasPlayRequests()) {
+        nextSlot = songState.requestedSlot();
+    } else if (songState.playing()) {
+        int currentSlot = songState.currentSlot();
+        if (currentSlot < song.slotCount() && songState.currentRepeat() + 1 >= song.slot(currentSlot).repeats()) {
+            nextSlot = currentSlot + 1 < song.slotCount() ? currentSlot + 1 : 0;
+        }
+    }
+    if (nextSlot >= song.slotCount()) {
+        nextSlot = -1;
+    }
+
+    for (int i = 0; i < CONFIG_TRACK_COUNT; ++i) {
+        int trackIndex = (_prepareTrack + i) % CONFIG_TRACK_COUNT;
+        const auto &trackState = playState.trackState(trackIndex);
+        int pattern = trackState.hasPatternRequest() ? trackState.requestedPattern() :
+                      nextSlot >= 0 ? song.slot(nextSlot).pattern(trackIndex) : trackState.pattern();
+        if (pattern != trackState.pattern()) {
+            _trackEngines[trackIndex]->preparePattern(pattern);
+            _prepareTrack = (trackIndex + 1) % CONFIG_TRACK_COUNT;
+            return;
+        }
+    }
+}
+
+void Engine::flushModulator(int modulatorIndex, float dt) {
+    uint32_t ticks = _modulatorPendingTicks[modulatorIndex];
+    if (ticks == 0) {
+        return;
+    }
+    _modulatorPendingTicks[modulatorIndex] = 0;
+
+    const auto &modulator = _project.modulator(modulatorIndex);
+    // JustF: Free-domain modulators run at M1 x INTONE-ratio (B-clamped); others as-is.
+    float rateOverride = -1.f;
+    const Modulator *envBase = nullptr;
+    bool justf = !_project.geode().active() && _modulatorEngine.justfActive();
+    if (justf && modulator.rateDomain() == Modulator::RateDomain::Free) {
+        rateOverride = ModulatorEngine::justfEffectiveHz(_project.modulator(0).rateHz(), _modulatorEngine.intone(), modulatorIndex + 1);
+        envBase = &_project.modulator(0);   // ADSR inherits M1's envelope, spread by index
+    }
+    _modulatorEngine.advance(ticks, dt, modulator, modulatorIndex, _modulatorPendingGate[modulatorIndex], rateOverride, envBase);
+    _midiOutputEngine.sendModulator(modulatorIndex, _modulatorEngine.currentValue(modulatorIndex));
+}
+
+void Engine::flushModulators(float dt) {
+    for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
+        flushModulator(modulatorIndex, dt);
     }
 }
 
@@ -1178,18 +1333,22 @@ void Engine::receiveMidi() {
 }
 
 void Engine::receiveMidi(MidiPort port, uint8_t cable, const MidiMessage &message) {
-    // filter out real-time and system messages
-    if (message.isRealTimeMessage() || message.isSystemMessage()) {
+    // filter out real-time and system messages (system exclusive is only passed to the receive handler)
+    if (message.isRealTimeMessage() || (message.isSystemMessage() && !message.isSystemExclusive())) {
         return;
     }
 
-    // let receive handler consume messages (controllers in UI task)
+    // let receive handler consume messages (controllers and SysEx queries in UI task)
     if (_midiReceiveHandler) {
         if (_midiReceiveHandler(port, cable, message)) {
             return;
         }
     }
 
+    if (message.isSystemExclusive()) {
+        return;
+    }
+
     // discard all messages not from cable 0
     if (cable != 0) {
         return;
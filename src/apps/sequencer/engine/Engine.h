@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EngineState.h"
+#include "EngineSnapshot.h"
 #include "Clock.h"
 #include "WallClock.h"
 #include "TapTempo.h"
@@ -27,6 +28,9 @@
 #include "MidiLearn.h"
 #include "CvGateToMidiConverter.h"
 #include "UpdateReducer.h"
+#include "EngineCommandQueue.h"
+#include "TrackOutputComposer.h"
+#include "TickCatchUp.h"
 
 #include "model/Model.h"
 
@@ -39,6 +43,8 @@
 #include "drivers/UsbMidi.h"
 #include "drivers/UsbH.h"
 
+#include "core/utils/TripleBuffer.h"
+
 #include <array>
 
 #include <cstdint>
@@ -70,6 +76,8 @@ public:
         uint32_t uptime;
         uint32_t midiRxOverflow;
         uint32_t usbMidiRxOverflow;
+        uint32_t usbMidiTxOverflow;
+        uint32_t usbMidiTxQueueHighWater;
     };
 
     Engine(Model &model, ClockTimer &clockTimer, Adc &adc, Dac &dac, Dio &dio, GateOutput &gateOutput, Midi &midi, UsbMidi &usbMidi, UsbH &usbH);
@@ -84,11 +92,32 @@ public:
     uint32_t engineUpdateMaxTicks() const { return _updateMaxTicks; }
     void resetEngineUpdateStats() { _updateLastUs = 0; _updateMaxUs = 0; _updateMaxTicks = 0; }
 
-    // locking temporarily puts the engine in a state where completely skips all updates
-    // lock should only be hold for very short amounts of time
-    void lock();
-    void unlock();
-    bool isLocked() const { return _locked; }
+    // how clock ticks that queued up while the engine task was late are processed
+    TickCatchUp::Policy tickCatchUpPolicy() const { return _tickCatchUp.policy(); }
+    void setTickCatchUpPolicy(TickCatchUp::Policy policy) { _tickCatchUp.setPolicy(policy); }
+
+    // commands are closures applied by the engine task at the start of a frame, right before
+    // track engines are (re)created, so they can safely change the model (pattern switches,
+    // track modes, step edits, clipboard pastes) without the engine skipping any updates
+    // post() returns immediately (false if the queue is full), invoke() waits until applied
+    template<typename F>
+    bool post(F &&command) {
+        return _commandQueue.post(std::forward<F>(command));
+    }
+
+    template<typename F>
+    void invoke(F &&command) {
+        // the caller blocks until the command is applied, so only a reference needs to be queued
+        auto *commandPtr = &command;
+        auto call = [commandPtr] () { (*commandPtr)(); };
+        uint32_t ticket;
+        while (!_commandQueue.post(call, &ticket)) {
+            waitForCommands();
+        }
+        while (!_commandQueue.applied(ticket)) {
+            waitForCommands();
+        }
+    }
 
     // suspending temporarily puts the engine in a state where it only processes basic events but skips all updates
     // suspending can be used during longer periods of time (e.g. file operations)
@@ -133,7 +162,14 @@ public:
     const CvOutput &cvOutput() const { return _cvOutput; }
     const uint8_t gateOutput() const { return _gateOutput.gates(); }
 
+    // Engine state of the last complete frame for the ui task. acquireSnapshot() switches to the
+    // newest published frame (false if there is none since the last call), snapshot() stays the
+    // same until the next acquireSnapshot(). Not updated while the engine is suspended.
+    bool acquireSnapshot() { return _snapshots.update(); }
+    const EngineSnapshot &snapshot() const { return _snapshots.read(); }
+
     static constexpr int BusCvCount = 4;
+    static_assert(BusCvCount == EngineSnapshot::BusCvCount, "snapshot bus lane count mismatch");
     // Per-lane writer-domain bits, set live at write, reset each frame. The bus page
     // reads busWriters() to light R/C/T glyphs as routes/CV-router/Teletype drive a lane.
     static constexpr uint8_t BusWriterRouting = 1 << 0;
@@ -194,6 +230,7 @@ public:
 
     void updateBusSafetyMode();
     void applyBusSafety();
+    void commitOutputs();
 
     const EngineState &state() const { return _state; }
 
@@ -255,12 +292,24 @@ private:
     virtual void onClockMidi(uint8_t data) override;
 
     void updateTrackSetups();
+    // Hot per-tick track engine calls, statically dispatched on the engine type.
+    TrackEngine::TickResult tickTrackEngine(int trackIndex, uint32_t tick);
+    uint32_t trackEngineNextTick(int trackIndex, uint32_t tick) const;
+    void updateTrackEngines(float dt);
+    bool trackEngineGateOutput(int trackIndex, int index) const;
+    float trackEngineCvOutput(int trackIndex, int index) const;
+
+    void publishSnapshot();
+    struct TrackOutputSource;
     void updateTrackOutputs();
     void updateCvRouteOutputs();
     void reset();
     void updatePlayState(bool ticked);
+    void preparePatterns();
 
     float applyModulatorOffset(int channel, float cvValue) const;
+    void flushModulator(int modulatorIndex, float dt);
+    void flushModulators(float dt);
     void updateOverrides();
 
     void usbMidiConnect(uint16_t vendorId, uint16_t productId);
@@ -295,6 +344,11 @@ private:
 
     TrackEngineContainerArray _trackEngineContainers;
     TrackEngineArray _trackEngines;
+    std::array<Track::TrackMode, CONFIG_TRACK_COUNT> _trackEngineModes; // type of each engine in _trackEngines
+    std::array<uint32_t, CONFIG_TRACK_COUNT> _trackNextTick; // next tick each track engine has to run (see TrackEngine::nextTick)
+    int _prepareTrack = 0; // round-robin start of preparePatterns()
+    TripleBuffer<EngineSnapshot> _snapshots;
+    TrackOutputComposer _trackOutputComposer; // cached jack plan of updateTrackOutputs()
     uint8_t _tt2CrossDepth = 0;
     UpdateReducer<os::time::ms(25)> _updateReducer; // rate-limit cap on the per-tick global recompute
 
@@ -304,6 +358,8 @@ private:
     ModulatorEngine _modulatorEngine;
     GeodeEngine _geodeEngine;   // modulator-driven Geode (Just Friends) voices, M3-M8
     bool _modulatorGateState[CONFIG_MODULATOR_COUNT] = {}; // hysteresis latch per modulator gate
+    uint32_t _modulatorPendingTicks[CONFIG_MODULATOR_COUNT] = {}; // ticks not yet applied (see flushModulator)
+    bool _modulatorPendingGate[CONFIG_MODULATOR_COUNT] = {};      // gate of the pending ticks
     MidiLearn _midiLearn;
     MidiReceiveHandler _midiReceiveHandler;
     UsbMidiConnectHandler _usbMidiConnectHandler;
@@ -314,9 +370,9 @@ private:
 
     CvGateToMidiConverter _cvGateToMidiConverter;
 
-    // locking
-    volatile uint32_t _requestLock = 0;
-    volatile uint32_t _locked = 0;
+    // commands
+    EngineCommandQueue<CONFIG_ENGINE_COMMAND_QUEUE_SIZE> _commandQueue;
+    void waitForCommands();
 
     // suspending
     volatile uint32_t _requestSuspend = 0;
@@ -328,6 +384,8 @@ private:
     uint32_t _lastWallUs = 0;
 
     void updateImpl();
+    static constexpr uint32_t UpdatePeriodUs = 1000; // engine task period
+    TickCatchUp _tickCatchUp;
     uint32_t _updateLastUs = 0;
     uint32_t _updateMaxUs = 0;
     uint32_t _updateTicks = 0;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+// Bounded lock-free command queue between producer tasks (ui, usbh, file) and the engine task.
+//
+// Any number of tasks can post commands, the engine task is the single consumer and applies
+// them in posting order at a defined point of the engine update. A command is a small closure
+// that is stored inline in its slot, so posting never allocates. Every posted command gets a
+// ticket which can be used to wait until the engine has applied it.
+//
+// Slots carry a sequence number (bounded MPMC queue by D. Vyukov): a producer claims a slot by
+// advancing the write position with a CAS, fills it and publishes it by bumping the sequence.
+template<size_t Capacity, size_t StorageSize = 24>
+class EngineCommandQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    EngineCommandQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            _slots[i].sequence.store(uint32_t(i), std::memory_order_relaxed);
+        }
+    }
+
+    EngineCommandQueue(const EngineCommandQueue &) = delete;
+    EngineCommandQueue &operator=(const EngineCommandQueue &) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // post a command, returns false if the queue is full
+    // the ticket (optional) can be passed to applied() to check for completion
+    template<typename F>
+    bool post(F &&command, uint32_t *ticket = nullptr) {
+        typedef typename std::decay<F>::type Command;
+        static_assert(sizeof(Command) <= StorageSize, "command does not fit into slot storage");
+        static_assert(alignof(Command) <= alignof(Storage), "command alignment not supported");
+
+        uint32_t pos = _write.load(std::memory_order_relaxed);
+        Slot *slot;
+        while (true) {
+            slot = &_slots[pos & (Capacity - 1)];
+            int32_t diff = int32_t(slot->sequence.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (_write.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _write.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (&slot->storage) Command(std::forward<F>(command));
+        slot->apply = &applyCommand<Command>;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        if (ticket) {
+            *ticket = pos + 1;
+        }
+        return true;
+    }
+
+    // apply all published commands in posting order (engine task only)
+    // returns the number of applied commands
+    int apply() {
+        int count = 0;
+        while (true) {
+            Slot &slot = _slots[_read & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != _read + 1) {
+                break;
+            }
+            slot.apply(&slot.storage);
+            slot.sequence.store(_read + Capacity, std::memory_order_release);
+            ++_read;
+            _applied.store(_read, std::memory_order_release);
+            ++count;
+        }
+        return count;
+    }
+
+    // returns true if the command with the given ticket has been applied
+    bool applied(uint32_t ticket) const {
+        return int32_t(_applied.load(std::memory_order_acquire) - ticket) >= 0;
+    }
+
+    bool empty() const {
+        return _applied.load(std::memory_order_acquire) == _write.load(std::memory_order_acquire);
+    }
+
+private:
+    typedef typename std::aligned_storage<StorageSize, alignof(std::max_align_t)>::type Storage;
+
+    template<typename Command>
+    static void applyCommand(void *storage) {
+        Command &command = *static_cast<Command *>(storage);
+        command();
+        command.~Command();
+    }
+
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        void (*apply)(void *storage);
+        Storage storage;
+    };
+
+    Slot _slots[Capacity];
+    std::atomic<uint32_t> _write { 0 };
+    std::atomic<uint32_t> _applied { 0 };
+    uint32_t _read = 0;
+};
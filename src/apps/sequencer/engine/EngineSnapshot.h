@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Config.h"
+
+#include "model/Track.h"
+
+#include <array>
+
+#include <cstdint>
+
+// Engine state as of the end of an engine frame, published by the engine task
+// and read by the ui task (see Engine::snapshot()). All values belong to the
+// same frame, so pages and LEDs never mix values from before and after a tick.
+struct EngineSnapshot {
+    struct TrackState {
+        Track::TrackMode trackMode;
+        int16_t currentStep;        // -1 if the engine has no step position
+        bool activity;
+        bool mute;
+        bool fill;
+        float sequenceProgress;     // -1 if the engine has no sequence
+    };
+
+    static constexpr int BusCvCount = 4;
+
+    uint8_t gateOutput;
+    std::array<float, CONFIG_CV_OUTPUT_CHANNELS> cvOutput;
+    std::array<TrackState, CONFIG_TRACK_COUNT> tracks;
+    std::array<float, BusCvCount> busCv;
+    std::array<uint8_t, BusCvCount> busWriters;
+    std::array<int16_t, CONFIG_MODULATOR_COUNT> modulatorValues;
+
+    const TrackState &track(int index) const { return tracks[index]; }
+    bool gate(int channel) const { return (gateOutput >> channel) & 1; }
+};
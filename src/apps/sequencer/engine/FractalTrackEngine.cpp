@@ -218,9 +218,11 @@ FractalTrackEngine::FractalTrackEngine(Engine &engine, const Model &model, Track
         FractalSequence &seq = sequence();
         int sf = seq.loopFirst(), sl = seq.loopLast(), sr = seq.rotate();
         int sbc = seq.branchCount(), sof = seq.ornFirst(), sol = seq.ornLast();
+        auto som = seq.orderMode();
         int std0 = _fractalTrack.trackDelay();
         seq.setLoopFirst(0); seq.setLoopLast(7); seq.setRotate(0);
         seq.setBranchCount(0); seq.setOrnFirst(1); seq.setOrnLast(0);
+        seq.setOrderMode(FractalSequence::OrderMode::Forward);
         for (int i = 0; i < 8; ++i) _trunk[i] = encodeCell(float(i + 1), 8, true);
         const uint32_t div = 12;
 
@@ -243,6 +245,7 @@ FractalTrackEngine::FractalTrackEngine(Engine &engine, const Model &model, Track
 
         seq.setLoopFirst(sf); seq.setLoopLast(sl); seq.setRotate(sr);
         seq.setBranchCount(sbc); seq.setOrnFirst(sof); seq.setOrnLast(sol);
+        seq.setOrderMode(som);
         _fractalTrack.setTrackDelay(std0);
     }
     reset();
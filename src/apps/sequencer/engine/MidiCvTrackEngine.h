@@ -28,6 +28,8 @@ public:
     virtual bool gateOutput(int index) const override;
     virtual float cvOutput(int index) const override;
 
+    virtual uint32_t eventQueueOverflows() const override { return _arpeggiatorEngine.eventQueueOverflows(); }
+
 private:
     static constexpr size_t VoiceCount = 8;
     static constexpr int RetriggerDelay = 2;
@@ -89,3 +91,5 @@ private:
     float _pitchCvOutputTarget;
     float _pitchCvOutput;
 };
+
+static_assert(sizeof(MidiCvTrackEngine) <= 944, "MidiCvTrackEngine too large (TeletypeTrackEngine at 944 is the container limit)");
@@ -130,14 +130,83 @@ public:
         }
     }
 
+    // Advance one clock tick.
     void tick(uint32_t tick, float dt, const Modulator &modulator, int index, bool gate,
               float rateHzOverride = -1.f, const Modulator *justfEnvBase = nullptr) {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+        advance(1, dt, modulator, index, gate, rateHzOverride, justfEnvBase);
+    }
+
+    // Advance `ticks` clock ticks with a constant gate. Same result as calling tick()
+    // `ticks` times, but LFO phases and ADSR stages advance in closed form and the
+    // output is evaluated once. Random, Spring and Chaos shapes still step per tick.
+    void advance(uint32_t ticks, float dt, const Modulator &modulator, int index, bool gate,
+                 float rateHzOverride = -1.f, const Modulator *justfEnvBase = nullptr) {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT || ticks == 0) {
             return;
         }
         // JustF (Free-domain) substitutes the derived rate for the modulator's own.
         const float effRateHz = (rateHzOverride >= 0.f) ? rateHzOverride : modulator.rateHz();
 
+        switch (modulator.shape()) {
+        case Modulator::Shape::Random:
+        case Modulator::Shape::Spring:
+        case Modulator::Shape::ChaosLorenz:
+        case Modulator::Shape::ChaosLatoocarfian:
+            for (uint32_t i = 0; i < ticks; ++i) {
+                tickStep(dt, modulator, index, gate, effRateHz);
+            }
+            break;
+        case Modulator::Shape::ADSR:
+            advanceAdsr(ticks, modulator, index, gate, justfEnvBase);
+            break;
+        default:
+            advanceLfo(ticks, dt, modulator, index, gate, effRateHz);
+            break;
+        }
+    }
+
+    int currentValue(int index) const {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+            return 0;
+        }
+        return _currentValue[index];
+    }
+
+    uint16_t currentPhase(int index) const {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+            return 0;
+        }
+        return _phaseAccumulator[index] & 0xFFFF;
+    }
+
+    // Geode: write an externally-driven voice level (0..1) into this modulator's output,
+    // through the same floor/invert transform a normal envelope uses (amplitude scales it).
+    void setVoiceOutput(int index, float level01, const Modulator &modulator) {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+            return;
+        }
+        int env = int(clamp(level01, 0.f, 1.f) * modulator.amplitude() + 0.5f);
+        _currentValue[index] = unipolarOutput(env, modulator.amplitude(),
+                                              modulator.floorValue(), modulator.invert());
+    }
+
+    ADSRState adsrState(int index) const {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+            return ADSRState::Idle;
+        }
+        return _adsrState[index];
+    }
+
+    uint32_t adsrTimer(int index) const {
+        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
+            return 0;
+        }
+        return _adsrTimer[index];
+    }
+
+private:
+    // Random, Spring and Chaos shapes: one clock tick.
+    void tickStep(float dt, const Modulator &modulator, int index, bool gate, float effRateHz) {
         // Random shape — driven by the universal Mode (uniform with Chaos):
         //   Run  = free-running clocked sample-and-hold (gate ignored)
         //   Trig = sample-and-hold on gate rising edge
@@ -252,104 +321,6 @@ public:
             return;
         }
 
-        // Handle ADSR shape
-        if (modulator.shape() == Modulator::Shape::ADSR) {
-            bool gateRising = gate && !_lastGate[index];
-            bool gateFalling = !gate && _lastGate[index];
-            _lastGate[index] = gate;
-
-            // JustF: inherit M1's envelope (A/D/R + sustain level) spread by this
-            // follower's index ratio; amplitude stays per-follower. justfEnvBase is M1
-            // when JustF is active, null otherwise (then the follower's own params).
-            int attackMs, decayMs, releaseMs, sustainLevel;
-            if (justfEnvBase) {
-                attackMs = justfEffectiveMs(justfEnvBase->attack(), _intone, index + 1);
-                decayMs = justfEffectiveMs(justfEnvBase->decay(), _intone, index + 1);
-                releaseMs = justfEffectiveMs(justfEnvBase->release(), _intone, index + 1);
-                sustainLevel = justfEnvBase->sustain();
-            } else {
-                attackMs = modulator.attack();
-                decayMs = modulator.decay();
-                releaseMs = modulator.release();
-                sustainLevel = modulator.sustain();
-            }
-
-            if (gateRising) {
-                _adsrState[index] = ADSRState::Attack;
-                _adsrTimer[index] = 0;
-            } else if (gateFalling && _adsrState[index] != ADSRState::Release) {
-                _adsrState[index] = ADSRState::Release;
-                _adsrTimer[index] = 0;
-            }
-
-            int level = 0;
-            switch (_adsrState[index]) {
-            case ADSRState::Idle:
-                level = 0;
-                break;
-            case ADSRState::Attack: {
-                if (attackMs == 0) {
-                    level = 127;
-                    _adsrState[index] = ADSRState::Decay;
-                    _adsrTimer[index] = 0;
-                } else {
-                    int attackTicks = (attackMs * CONFIG_PPQN) / 2500;
-                    if (attackTicks < 1) attackTicks = 1;
-                    _adsrTimer[index]++;
-                    level = clamp(static_cast<int>((127 * _adsrTimer[index]) / attackTicks), 0, 127);
-                    if (level >= 127) {
-                        _adsrState[index] = ADSRState::Decay;
-                        _adsrTimer[index] = 0;
-                    }
-                }
-                break;
-            }
-            case ADSRState::Decay: {
-                if (decayMs == 0 || sustainLevel >= 127) {
-                    level = sustainLevel;
-                    _adsrState[index] = ADSRState::Sustain;
-                } else {
-                    int decayTicks = (decayMs * CONFIG_PPQN) / 2500;
-                    if (decayTicks < 1) decayTicks = 1;
-                    _adsrTimer[index]++;
-                    int decayAmount = 127 - sustainLevel;
-                    level = 127 - clamp(static_cast<int>((decayAmount * _adsrTimer[index]) / decayTicks), 0, decayAmount);
-                    if (level <= sustainLevel) {
-                        level = sustainLevel;
-                        _adsrState[index] = ADSRState::Sustain;
-                    }
-                }
-                break;
-            }
-            case ADSRState::Sustain:
-                level = sustainLevel;
-                break;
-            case ADSRState::Release: {
-                int startLevel = _adsrLevel[index];
-                if (releaseMs == 0) {
-                    level = 0;
-                    _adsrState[index] = ADSRState::Idle;
-                } else {
-                    int releaseTicks = (releaseMs * CONFIG_PPQN) / 2500;
-                    if (releaseTicks < 1) releaseTicks = 1;
-                    _adsrTimer[index]++;
-                    level = startLevel - clamp(static_cast<int>((startLevel * _adsrTimer[index]) / releaseTicks), 0, startLevel);
-                    if (level <= 0) {
-                        level = 0;
-                        _adsrState[index] = ADSRState::Idle;
-                    }
-                }
-                break;
-            }
-            }
-
-            _adsrLevel[index] = level;
-            int env = (level * modulator.amplitude()) / 127;
-            _currentValue[index] = unipolarOutput(env, modulator.amplitude(),
-                                                  modulator.floorValue(), modulator.invert());
-            return;
-        }
-
         // Chaos shapes (Lorenz, Latoocarfian)
         if (modulator.shape() == Modulator::Shape::ChaosLorenz ||
             modulator.shape() == Modulator::Shape::ChaosLatoocarfian) {
@@ -418,7 +389,125 @@ public:
             _currentValue[index] = bipolarOutput(value + 64, modulator.invert());
             return;
         }
+    }
+
+    // ADSR: gate edges can only occur on the first tick of a batch. Attack and decay
+    // skip ahead to the end of their stage, release scales from the previous level on
+    // every tick so it steps per tick.
+    void advanceAdsr(uint32_t ticks, const Modulator &modulator, int index, bool gate, const Modulator *justfEnvBase) {
+        bool gateRising = gate && !_lastGate[index];
+        bool gateFalling = !gate && _lastGate[index];
+        _lastGate[index] = gate;
+
+        // JustF: inherit M1's envelope (A/D/R + sustain level) spread by this
+        // follower's index ratio; amplitude stays per-follower. justfEnvBase is M1
+        // when JustF is active, null otherwise (then the follower's own params).
+        int attackMs, decayMs, releaseMs, sustainLevel;
+        if (justfEnvBase) {
+            attackMs = justfEffectiveMs(justfEnvBase->attack(), _intone, index + 1);
+            decayMs = justfEffectiveMs(justfEnvBase->decay(), _intone, index + 1);
+            releaseMs = justfEffectiveMs(justfEnvBase->release(), _intone, index + 1);
+            sustainLevel = justfEnvBase->sustain();
+        } else {
+            attackMs = modulator.attack();
+            decayMs = modulator.decay();
+            releaseMs = modulator.release();
+            sustainLevel = modulator.sustain();
+        }
+
+        if (gateRising) {
+            _adsrState[index] = ADSRState::Attack;
+            _adsrTimer[index] = 0;
+        } else if (gateFalling && _adsrState[index] != ADSRState::Release) {
+            _adsrState[index] = ADSRState::Release;
+            _adsrTimer[index] = 0;
+        }
+
+        // number of ticks to advance a linear stage, clamped to the end of the stage
+        auto stageSteps = [] (uint32_t remaining, uint32_t timer, int stageTicks) {
+            uint32_t left = timer < uint32_t(stageTicks) ? uint32_t(stageTicks) - timer : 1;
+            return left < remaining ? left : remaining;
+        };
 
+        int level = _adsrLevel[index];
+        uint32_t remaining = ticks;
+        while (remaining > 0) {
+            uint32_t steps = 1;
+            switch (_adsrState[index]) {
+            case ADSRState::Idle:
+                level = 0;
+                steps = remaining;
+                break;
+            case ADSRState::Attack: {
+                if (attackMs == 0) {
+                    level = 127;
+                    _adsrState[index] = ADSRState::Decay;
+                    _adsrTimer[index] = 0;
+                } else {
+                    int attackTicks = (attackMs * CONFIG_PPQN) / 2500;
+                    if (attackTicks < 1) attackTicks = 1;
+                    steps = stageSteps(remaining, _adsrTimer[index], attackTicks);
+                    _adsrTimer[index] += steps;
+                    level = clamp(static_cast<int>((127 * _adsrTimer[index]) / attackTicks), 0, 127);
+                    if (level >= 127) {
+                        _adsrState[index] = ADSRState::Decay;
+                        _adsrTimer[index] = 0;
+                    }
+                }
+                break;
+            }
+            case ADSRState::Decay: {
+                if (decayMs == 0 || sustainLevel >= 127) {
+                    level = sustainLevel;
+                    _adsrState[index] = ADSRState::Sustain;
+                } else {
+                    int decayTicks = (decayMs * CONFIG_PPQN) / 2500;
+                    if (decayTicks < 1) decayTicks = 1;
+                    steps = stageSteps(remaining, _adsrTimer[index], decayTicks);
+                    _adsrTimer[index] += steps;
+                    int decayAmount = 127 - sustainLevel;
+                    level = 127 - clamp(static_cast<int>((decayAmount * _adsrTimer[index]) / decayTicks), 0, decayAmount);
+                    if (level <= sustainLevel) {
+                        level = sustainLevel;
+                        _adsrState[index] = ADSRState::Sustain;
+                    }
+                }
+                break;
+            }
+            case ADSRState::Sustain:
+                level = sustainLevel;
+                steps = remaining;
+                break;
+            case ADSRState::Release: {
+                int startLevel = _adsrLevel[index];
+                if (releaseMs == 0) {
+                    level = 0;
+                    _adsrState[index] = ADSRState::Idle;
+                } else {
+                    int releaseTicks = (releaseMs * CONFIG_PPQN) / 2500;
+                    if (releaseTicks < 1) releaseTicks = 1;
+                    _adsrTimer[index]++;
+                    level = startLevel - clamp(static_cast<int>((startLevel * _adsrTimer[index]) / releaseTicks), 0, startLevel);
+                    if (level <= 0) {
+                        level = 0;
+                        _adsrState[index] = ADSRState::Idle;
+                    }
+                }
+                break;
+            }
+            }
+            _adsrLevel[index] = level;
+            remaining -= steps;
+        }
+
+        int env = (level * modulator.amplitude()) / 127;
+        _currentValue[index] = unipolarOutput(env, modulator.amplitude(),
+                                              modulator.floorValue(), modulator.invert());
+    }
+
+    // Standard LFO shapes: the output only depends on the final phase, so a batch of
+    // ticks advances the phase in one step (Free domain keeps its per-tick carry).
+    void advanceLfo(uint32_t ticks, float dt, const Modulator &modulator, int index, bool gate, float effRateHz) {
         // Standard LFO modes (Sine, Triangle, Saw, Square)
 
         // Gate modes: Trig restarts from the phase offset on gate rising (offset 0 = hard
@@ -438,18 +527,15 @@ public:
         }
 
         // Increment phase: Free advances by real dt*Hz (drift-free), Tempo by the PPQN division.
-        uint32_t phaseIncrement = (modulator.rateDomain() == Modulator::RateDomain::Free)
-            ? freePhaseIncrement(dt, effRateHz, _freeRemainder[index])
-            : 65536 / (modulator.rate() * 2);
-
-        if (modulator.mode() == Modulator::Mode::Gate) {
-            // Gate: only advance phase while gate is high
-            if (gate) {
-                _phaseAccumulator[index] += phaseIncrement;
+        // Gate mode only advances while the gate is high, Run/Trig always advance.
+        if (modulator.mode() != Modulator::Mode::Gate || gate) {
+            if (modulator.rateDomain() == Modulator::RateDomain::Free) {
+                for (uint32_t i = 0; i < ticks; ++i) {
+                    _phaseAccumulator[index] += freePhaseIncrement(dt, effRateHz, _freeRemainder[index]);
+                }
+            } else {
+                _phaseAccumulator[index] += ticks * (65536 / (modulator.rate() * 2));
             }
-        } else {
-            // Run/Trig: always advance
-            _phaseAccumulator[index] += phaseIncrement;
         }
 
         uint32_t phase = _phaseAccumulator[index] + (static_cast<uint32_t>(modulator.phase()) * 65536 / 360);
@@ -465,46 +551,6 @@ public:
         _currentValue[index] = clamp(value + 64, 0, 127);
     }
 
-    int currentValue(int index) const {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
-            return 0;
-        }
-        return _currentValue[index];
-    }
-
-    uint16_t currentPhase(int index) const {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
-            return 0;
-        }
-        return _phaseAccumulator[index] & 0xFFFF;
-    }
-
-    // Geode: write an externally-driven voice level (0..1) into this modulator's output,
-    // through the same floor/invert transform a normal envelope uses (amplitude scales it).
-    void setVoiceOutput(int index, float level01, const Modulator &modulator) {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
-            return;
-        }
-        int env = int(clamp(level01, 0.f, 1.f) * modulator.amplitude() + 0.5f);
-        _currentValue[index] = unipolarOutput(env, modulator.amplitude(),
-                                              modulator.floorValue(), modulator.invert());
-    }
-
-    ADSRState adsrState(int index) const {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
-            return ADSRState::Idle;
-        }
-        return _adsrState[index];
-    }
-
-    uint32_t adsrTimer(int index) const {
-        if (index < 0 || index >= CONFIG_MODULATOR_COUNT) {
-            return 0;
-        }
-        return _adsrTimer[index];
-    }
-
-private:
     void resetChaos(int index, Modulator::Shape shape, uint16_t phase) {
         if (shape == Modulator::Shape::ChaosLorenz) {
             _lorenz[index].reset();
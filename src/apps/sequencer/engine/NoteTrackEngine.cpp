@@ -4,6 +4,7 @@
 #include "Groove.h"
 #include "Slide.h"
 #include "SequenceUtils.h"
+#include "KeyedRng.h"
 
 #include "core/Debug.h"
 #include "core/utils/Random.h"
@@ -16,10 +17,12 @@
 
 #include <cmath>
 
-static Random rng;
+// base seeds of the keyed random streams
+static constexpr uint32_t StepSeed = 0x4e6f7465u;     // per (track, pattern, step, pulse, iteration)
+static constexpr uint32_t RunModeSeed = 0x52756e4du;  // per (track, pattern) for random run modes
 
 // evaluate if step gate is active
-static bool evalStepGate(const NoteSequence::Step &step, int probabilityBias) {
+static bool evalStepGate(Random &rng, const NoteSequence::Step &step, int probabilityBias) {
     int probability = clamp(step.gateProbability() + probabilityBias, -1, NoteSequence::GateProbability::Max);
     return step.gate() && int(rng.nextRange(NoteSequence::GateProbability::Range)) <= probability;
 }
@@ -48,13 +51,13 @@ static bool evalStepCondition(const NoteSequence::Step &step, int iteration, boo
 }
 
 // evaluate step retrigger count
-static int evalStepRetrigger(const NoteSequence::Step &step, int probabilityBias) {
+static int evalStepRetrigger(Random &rng, const NoteSequence::Step &step, int probabilityBias) {
     int probability = clamp(step.retriggerProbability() + probabilityBias, -1, NoteSequence::RetriggerProbability::Max);
     return int(rng.nextRange(NoteSequence::RetriggerProbability::Range)) <= probability ? step.retrigger() + 1 : 1;
 }
 
 // evaluate step length
-static int evalStepLength(const NoteSequence::Step &step, int lengthBias) {
+static int evalStepLength(Random &rng, const NoteSequence::Step &step, int lengthBias) {
     int length = NoteSequence::Length::clamp(step.length() + lengthBias) + 1;
     int probability = step.lengthVariationProbability();
     if (int(rng.nextRange(NoteSequence::LengthVariationProbability::Range)) <= probability) {
@@ -73,7 +76,7 @@ static int evalTransposition(const Scale &scale, int octave, int transpose) {
 }
 
 // evaluate note voltage
-static float evalStepNote(const NoteSequence::Step &step, int probabilityBias, const Scale &scale, int rootNote, int octave, int transpose, const NoteSequence &sequence, bool useVariation = true) {
+static float evalStepNote(Random &rng, const NoteSequence::Step &step, int probabilityBias, const Scale &scale, int rootNote, int octave, int transpose, const NoteSequence &sequence, bool useVariation = true) {
     int note = step.note() + evalTransposition(scale, octave, transpose);
 
     // Apply accumulator modulation if enabled
@@ -120,6 +123,7 @@ void NoteTrackEngine::reset() {
     _reReneYGatePrev = false;
     _sequenceState.reset();
     _noteSequenceState.reset();
+    _rng = keyed_rng::forCell(RunModeSeed, uint32_t(_track.trackIndex()) | uint32_t(pattern()) << 3);
     _currentStep = -1;
     _prevCondition = false;
     _pulseCounter = 0;
@@ -202,7 +206,7 @@ TrackEngine::TickResult NoteTrackEngine::tick(uint32_t tick) {
                 // Advance BEFORE trigger (matches CurveTrackEngine pattern)
                 if (_sequenceState.step() < 0) {
                     // Initial: use advanceFree to respect run mode
-                    _sequenceState.advanceFree(sequence.runMode(), sequence.firstStep(), sequence.lastStep(), rng);
+                    _sequenceState.advanceFree(sequence.runMode(), sequence.firstStep(), sequence.lastStep(), _rng);
                     _pulseCounter = 0;
                 } else {
                     // Check if current step's pulses are complete. Read the pulse
@@ -213,7 +217,7 @@ TrackEngine::TickResult NoteTrackEngine::tick(uint32_t tick) {
                                                                _noteTrack.rotate());
                     if (_pulseCounter > stepPulseCount) {
                         _pulseCounter = 0;
-                        _sequenceState.advanceAligned(relativeTick / divisor, sequence.runMode(), sequence.firstStep(), sequence.lastStep(), rng);
+                        _sequenceState.advanceAligned(relativeTick / divisor, sequence.runMode(), sequence.firstStep(), sequence.lastStep(), _rng);
                     }
                 }
 
@@ -223,7 +227,7 @@ TrackEngine::TickResult NoteTrackEngine::tick(uint32_t tick) {
                 triggerStep(tick, divisor);
             }
             if (sequence.mode() == NoteSequence::Mode::Ikra && relativeTick % noteDivisor == 0) {
-                _noteSequenceState.advanceAligned(relativeTick / noteDivisor, sequence.runMode(), sequence.noteFirstStep(), sequence.noteLastStep(), rng);
+                _noteSequenceState.advanceAligned(relativeTick / noteDivisor, sequence.runMode(), sequence.noteFirstStep(), sequence.noteLastStep(), _rng);
             }
             break;
         case Types::PlayMode::Free:
@@ -352,13 +356,13 @@ TrackEngine::TickResult NoteTrackEngine::tick(uint32_t tick) {
                 divisor = stepDivisor;
             } else if (sequence.mode() == NoteSequence::Mode::Ikra && noteStepIndex != _lastNoteFreeStepIndex) {
                 _lastNoteFreeStepIndex = noteStepIndex;
-                _noteSequenceState.advanceFree(sequence.runMode(), sequence.noteFirstStep(), sequence.noteLastStep(), rng);
+                _noteSequenceState.advanceFree(sequence.runMode(), sequence.noteFirstStep(), sequence.noteLastStep(), _rng);
             } else if (stepIndex != _lastFreeStepIndex) {
                 _lastFreeStepIndex = stepIndex;
 
                 // Phase-lock: always sync sequence step to clock stepIndex
                 // advanceAligned maps stepIndex to correct sequence step based on run mode
-                _sequenceState.advanceAligned(stepIndex, sequence.runMode(), sequence.firstStep(), sequence.lastStep(), rng);
+                _sequenceState.advanceAligned(stepIndex, sequence.runMode(), sequence.firstStep(), sequence.lastStep(), _rng);
                 _pulseCounter = 0;
 
                 // Trigger the (now current) step
@@ -443,6 +447,43 @@ TrackEngine::TickResult NoteTrackEngine::tick(uint32_t tick) {
     return result;
 }
 
+// next tick that is a multiple of divisor relative to the reset measure (which always restarts at 0)
+static uint32_t nextDivisorTick(uint32_t tick, uint32_t divisor, uint32_t resetDivisor) {
+    uint32_t relativeTick = resetDivisor == 0 ? tick : tick % resetDivisor;
+    uint32_t next = ((relativeTick + divisor - 1) / divisor) * divisor;
+    if (resetDivisor != 0 && next >= resetDivisor) {
+        next = resetDivisor;
+    }
+    return tick + (next - relativeTick);
+}
+
+uint32_t NoteTrackEngine::nextTick(uint32_t tick) const {
+    // free mode follows the fractional clock position, so it has to run every tick
+    if (_noteTrack.playMode() != Types::PlayMode::Aligned) {
+        return tick;
+    }
+
+    const auto &sequence = *_sequence;
+    float clockMult = sequence.clockMultiplier() * 0.01f;
+    uint32_t divisor = sequence.divisor() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+    divisor = std::max<uint32_t>(1, std::lround(divisor / clockMult));
+    uint32_t resetDivisor = sequence.resetMeasure() * _engine.measureDivisor();
+
+    uint32_t next = nextDivisorTick(tick, divisor, resetDivisor);
+    if (sequence.mode() == NoteSequence::Mode::Ikra) {
+        uint32_t noteDivisor = sequence.divisorY() * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
+        noteDivisor = std::max<uint32_t>(1, std::lround(noteDivisor / clockMult));
+        next = std::min(next, nextDivisorTick(tick, noteDivisor, resetDivisor));
+    }
+    if (!_gateQueue.empty()) {
+        next = std::min(next, std::max(tick, _gateQueue.front().tick));
+    }
+    if (!_cvQueue.empty()) {
+        next = std::min(next, std::max(tick, _cvQueue.front().tick));
+    }
+    return next;
+}
+
 void NoteTrackEngine::update(float dt) {
     // Length-0 trig: drop the gate once the 6 ms wall-clock deadline passes.
     if (_trigGateActive && int32_t(os::ticks() - _trigGateOffTicks) >= 0) {
@@ -511,7 +552,7 @@ void NoteTrackEngine::update(float dt) {
 
     if (stepMonitoring) {
         const auto &step = sequence.step(_monitorStepIndex);
-        setOverride(evalStepNote(step, 0, scale, rootNote, octave, transpose, sequence, false));
+        setOverride(evalStepNote(_rng, step, 0, scale, rootNote, octave, transpose, sequence, false));
     } else if (liveMonitoring && _recordHistory.isNoteActive()) {
         int note = noteFromMidiNote(_recordHistory.activeNote()) + evalTransposition(scale, octave, transpose);
         setOverride(scale.noteToVolts(note) + (scale.isChromatic() ? rootNote : 0) * (1.f / 12.f));
@@ -564,14 +605,20 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
     int octave = _noteTrack.octave();
     int transpose = _noteTrack.transpose();
     int rotate = _noteTrack.rotate();
+
+    const auto &sequence = *_sequence;
+    _currentStep = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
+
+    // all random decisions of this step come from its own keyed stream, so they don't
+    // depend on other tracks or on how many random numbers previous steps consumed
+    Random rng = stepRng();
+
     bool fillStep = fill() && (rng.nextRange(100) < uint32_t(fillAmount()));
     bool useFillGates = fillStep && _noteTrack.fillMode() == NoteTrack::FillMode::Gates;
     bool useFillSequence = fillStep && _noteTrack.fillMode() == NoteTrack::FillMode::NextPattern;
     bool useFillCondition = fillStep && _noteTrack.fillMode() == NoteTrack::FillMode::Condition;
 
-    const auto &sequence = *_sequence;
     const auto &evalSequence = useFillSequence ? *_fillSequence : *_sequence;
-    _currentStep = SequenceUtils::rotateStep(_sequenceState.step(), sequence.firstStep(), sequence.lastStep(), rotate);
     const auto &step = evalSequence.step(_currentStep);
     int noteStepIndex = _currentStep;
     if (sequence.mode() == NoteSequence::Mode::Ikra) {
@@ -629,7 +676,7 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
 
     uint32_t gateOffset = (divisor * step.gateOffset()) / (NoteSequence::GateOffset::Max + 1);
 
-    bool stepGate = evalStepGate(step, _noteTrack.gateProbabilityBias()) || useFillGates;
+    bool stepGate = evalStepGate(rng, step, _noteTrack.gateProbabilityBias()) || useFillGates;
     if (stepGate) {
         stepGate = evalStepCondition(step, _sequenceState.iteration(), useFillCondition, _prevCondition);
     }
@@ -700,14 +747,14 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
                 _gateQueue.pushReplace({ Groove::applySwing(tick + gateOffset, swing()), true, true });
 #endif
             } else {
-            uint32_t stepLength = (divisor * evalStepLength(step, _noteTrack.lengthBias())) / NoteSequence::Length::Range;
+            uint32_t stepLength = (divisor * evalStepLength(rng, step, _noteTrack.lengthBias())) / NoteSequence::Length::Range;
 
             // HOLD mode: extend gate length to cover all pulses
             if (gateMode == 2) {
                 stepLength = divisor * (pulseCount + 1);
             }
 
-            int stepRetrigger = evalStepRetrigger(step, _noteTrack.retriggerProbabilityBias());
+            int stepRetrigger = evalStepRetrigger(rng, step, _noteTrack.retriggerProbabilityBias());
             if (stepRetrigger > 1) {
 #if !CONFIG_EXPERIMENTAL_SPREAD_RTRIG_TICKS
                 // BURST MODE (flag=0): Tick accumulator for each retrigger subdivision (all at once)
@@ -771,7 +818,7 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
 
                 if (shouldTickAccum) {
                     // Evaluate base note
-                    float baseNote = evalStepNote(step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
+                    float baseNote = evalStepNote(rng, step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
                     // Apply harmony if follower
                     baseCv = applyHarmony(baseNote, step, evalSequence, scale, octave, transpose);
                 }
@@ -836,7 +883,7 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
                     const auto &scale = evalSequence.selectedScale(_model.project().scale(), _model.project().scaleRotate());
                     int rootNote = evalSequence.selectedRootNote(_model.project().rootNote());
                     // Evaluate base note
-                    float baseNote = evalStepNote(step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
+                    float baseNote = evalStepNote(rng, step, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
                     // Apply harmony if follower
                     retrigCv = applyHarmony(baseNote, step, evalSequence, scale, octave, transpose);
                     // For first retrigger, use current accumulator value (before tick)
@@ -856,7 +903,7 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
         int rootNote = evalSequence.selectedRootNote(_model.project().rootNote());
 
         // Evaluate base note (without harmony)
-        float baseNote = evalStepNote(noteStep, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
+        float baseNote = evalStepNote(rng, noteStep, _noteTrack.noteProbabilityBias(), scale, rootNote, octave, transpose, evalSequence);
 
         // Apply harmony if this track is a follower (has engine-level access)
         float finalNote = applyHarmony(baseNote, noteStep, evalSequence, scale, octave, transpose);
@@ -865,6 +912,14 @@ void NoteTrackEngine::triggerStep(uint32_t tick, uint32_t divisor) {
     }
 }
 
+Random NoteTrackEngine::stepRng() const {
+    uint32_t key = uint32_t(_track.trackIndex()) |
+                   uint32_t(pattern()) << 3 |
+                   uint32_t(_currentStep & 0xff) << 8 |
+                   uint32_t(_pulseCounter & 0xff) << 16;
+    return keyed_rng::forCell(keyed_rng::cellSeed(StepSeed, key), uint32_t(_sequenceState.iteration()));
+}
+
 void NoteTrackEngine::recordStep(uint32_t tick, uint32_t divisor) {
     if (!_engine.state().recording() || _model.project().recordMode() == Types::RecordMode::StepRecord || _sequenceState.prevStep() < 0) {
         return;
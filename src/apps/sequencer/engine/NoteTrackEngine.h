@@ -3,7 +3,7 @@
 #include "Config.h"
 #include "TrackEngine.h"
 #include "SequenceState.h"
-#include "SortedQueue.h"
+#include "TimingWheel.h"
 #include "Groove.h"
 #include "RecordHistory.h"
 #include "StepRecorder.h"
@@ -29,12 +29,6 @@ public:
         bool trig;
     };
 
-    struct GateCompare {
-        bool operator()(const Gate &a, const Gate &b) {
-            return a.tick < b.tick;
-        }
-    };
-
     NoteTrackEngine(Engine &engine, const Model &model, Track &track) :
         TrackEngine(engine, model, track),
         _noteTrack(track.noteTrack())
@@ -48,6 +42,7 @@ public:
     virtual void stop() override;
     virtual void restart() override;
     virtual TickResult tick(uint32_t tick) override;
+    virtual uint32_t nextTick(uint32_t tick) const override;
     virtual void update(float dt) override;
 
     virtual void changePattern() override;
@@ -61,6 +56,7 @@ public:
     virtual float sequenceProgress() const override {
         return _currentStep < 0 ? 0.f : float(_currentStep - _sequence->firstStep()) / (_sequence->lastStep() - _sequence->firstStep());
     }
+    virtual uint32_t eventQueueOverflows() const override { return _gateQueue.overflows() + _cvQueue.overflows(); }
 
     const NoteSequence &sequence() const { return *_sequence; }
     bool isActiveSequence(const NoteSequence &sequence) const { return &sequence == _sequence; }
@@ -79,6 +75,7 @@ public:
 
 private:
     void triggerStep(uint32_t tick, uint32_t divisor);
+    Random stepRng() const;
     void recordStep(uint32_t tick, uint32_t divisor);
     int noteFromMidiNote(uint8_t midiNote) const;
     float applyHarmony(float baseNote, const NoteSequence::Step &step, const NoteSequence &sequence, const Scale &scale, int octave, int transpose);
@@ -105,6 +102,7 @@ private:
     int _reReneDivYTrack = 0;
     bool _reReneYGatePrev = false;
     SequenceState _sequenceState;
+    Random _rng;        // keyed per (track, pattern) stream for random run modes
     int _currentStep;
     bool _prevCondition;
     int _pulseCounter;  // Tracks current pulse within step for pulse count feature
@@ -123,7 +121,7 @@ private:
     float _cvOutputTarget;
     bool _slideActive;
 
-    SortedQueue<Gate, 16, GateCompare> _gateQueue;
+    TimingWheel<Gate, 16> _gateQueue;
 
     struct Cv {
         uint32_t tick;
@@ -131,11 +129,7 @@ private:
         bool slide;
     };
 
-    struct CvCompare {
-        bool operator()(const Cv &a, const Cv &b) {
-            return a.tick < b.tick;
-        }
-    };
-
-    SortedQueue<Cv, 16, CvCompare> _cvQueue;
+    TimingWheel<Cv, 16> _cvQueue;
 };
+
+static_assert(sizeof(NoteTrackEngine) <= 944, "NoteTrackEngine too large (TeletypeTrackEngine at 944 is the container limit)");
@@ -205,6 +205,10 @@ bool PhaseFluxTrackEngine::detectLayoutChange() {
     if (lenN != _cachedLenNudge) return true;
     if (uint8_t(_sequence->firstStage()) != _cachedFirstStage) return true;
     if (uint8_t(_sequence->lastStage()) != _cachedLastStage) return true;
+    // Traversal order, cycle mode and the measure floor shape the table too.
+    if (uint8_t(_sequence->traversalPattern()) != _cachedTraversal) return true;
+    if (_sequence->cycleLength() != _cachedCycleLength) return true;
+    if (_engine.measureDivisor() != _cachedMeasureDivisor) return true;
     for (int i = 0; i < kStageCount; ++i) {
         const auto &s = _sequence->stage(i);
         if (uint8_t(s.length()) != _cachedLength[i]) return true;
@@ -238,6 +242,9 @@ void PhaseFluxTrackEngine::rebuildCumulativeTable() {
     _cachedLenNudge = int8_t(_sequence->lenNudge());
     _cachedFirstStage = uint8_t(firstStage);
     _cachedLastStage = uint8_t(lastStage);
+    _cachedTraversal = uint8_t(_sequence->traversalPattern());
+    _cachedCycleLength = _sequence->cycleLength();
+    _cachedMeasureDivisor = _engine.measureDivisor();
 
     const bool fixedCycle =
         _sequence->cycleLength() == PhaseFluxSequence::CycleLengthMode::Fixed;
@@ -621,7 +628,7 @@ TrackEngine::TickResult PhaseFluxTrackEngine::tick(uint32_t tick) {
     bool valid = PhaseFluxMath::deriveTickPosition(
         PhaseFluxMath::traversalOrder(_sequence->traversalPattern()),
         relativeTick, _cumulativeTicks, _cycleTicks,
-        slotIdx, activeCell, stagePhase);
+        slotIdx, activeCell, stagePhase, _slotIdx);
 
     if (!valid) {
         // §3.5 idle — hold gate low, freeze counters, preserve CV.
@@ -103,6 +103,9 @@ private:
     int8_t _cachedLenNudge = 0;
     uint8_t _cachedFirstStage = 0;
     uint8_t _cachedLastStage = 0;
+    uint8_t _cachedTraversal = 0;
+    PhaseFluxSequence::CycleLengthMode _cachedCycleLength = PhaseFluxSequence::CycleLengthMode::Adaptive;
+    uint32_t _cachedMeasureDivisor = 0;
 
     // Dual-accumulator state (spec §13.3, Task 5).
     // Local scope uses [cell] index; Track scope shares [0].
@@ -11,6 +11,9 @@
 
 #include "core/utils/Random.h"
 #include "core/math/Math.h"
+#include "core/hash/FnvHash.h"
+
+#include "Platform.h"   // CCMRAM_BSS
 
 #include <cmath>
 #include <algorithm>
@@ -40,6 +43,18 @@ int directHistoryTrackIndex(const Track &track) {
 // The engine cache lives inside StochasticTrackEngine as a member (`_stepCache`),
 // not in a file-scope per-track array, so memory is only paid for tracks
 // that actually run in Stochastic mode.
+
+// Cache prepared by preparePattern() for the pattern a track switches to next.
+// Kept outside the engine to stay within the track-engine container; the
+// engine adopts it on changePattern() if the key still matches.
+struct PreparedStepCache {
+    stochastic_cache::StepCache cache;
+    uint32_t key;
+    int8_t pattern;
+    bool valid;
+};
+
+CCMRAM_BSS PreparedStepCache preparedStepCaches[CONFIG_TRACK_COUNT];
 }
 
 // Gate scheduling trace — disabled for release
@@ -185,9 +200,39 @@ void StochasticTrackEngine::reset() {
     _gateQueue.clear();
     _cvQueue.clear();
     _rng = Random(0x12345678 + _track.trackIndex());
+    _stepCacheKeyValid = false;
+    preparedStepCaches[directHistoryTrackIndex(_track)].valid = false;
     changePattern();
 }
 
+void StochasticTrackEngine::changePattern() {
+    _sequence = &(_stochasticTrack.sequence(pattern()));
+
+    // In-flight queue entries targeted the previous sequence's timing/CV;
+    // discard them on pattern switch.
+    _gateQueue.clear();
+    _cvQueue.clear();
+    _patternCycleEnded = false;
+    _lastStepContentValid = false;
+    clearDirectHistory();
+    // Cache is per-track and was built for the previous pattern's events;
+    // adopt the prepared cache or rebuild for the new pattern.
+    updateStepCache();
+}
+
+void StochasticTrackEngine::preparePattern(int pattern) {
+    auto &prepared = preparedStepCaches[directHistoryTrackIndex(_track)];
+    const auto &seq = stochasticTrack().sequence(pattern);
+    uint32_t key = stepCacheKey(seq);
+    if (prepared.valid && prepared.pattern == pattern && prepared.key == key) {
+        return;
+    }
+    buildStepCache(prepared.cache, seq);
+    prepared.key = key;
+    prepared.pattern = pattern;
+    prepared.valid = true;
+}
+
 void StochasticTrackEngine::restart() {
     _currentStep = stochasticTrack().sequence(pattern()).first();
     _relativeTick = 0;
@@ -826,25 +871,71 @@ void StochasticTrackEngine::syncWindowEdit() {
 
     // Cache rank ordering was built for the old window — windowSize feeds the
     // mask threshold and the rank distribution was assigned over the old
-    // window's step set. Rebuild for the new window.
-    refreshStepCache();
+    // window's step set. Rebuild for the new window (song slot advances
+    // restart with unchanged content, skip the rebuild then).
+    updateStepCache();
 }
 
 void StochasticTrackEngine::refreshStepCache() {
-    auto &seq = sequence();
+    buildStepCache(_stepCache, sequence());
+    _stepCacheKey = stepCacheKey(sequence());
+    _stepCacheKeyValid = true;
+}
+
+void StochasticTrackEngine::updateStepCache() {
+    uint32_t key = stepCacheKey(sequence());
+    if (_stepCacheKeyValid && _stepCacheKey == key) {
+        return;
+    }
+    auto &prepared = preparedStepCaches[directHistoryTrackIndex(_track)];
+    if (prepared.valid && prepared.pattern == pattern() && prepared.key == key) {
+        _stepCache = prepared.cache;
+    } else {
+        buildStepCache(_stepCache, sequence());
+    }
+    _stepCacheKey = key;
+    _stepCacheKeyValid = true;
+}
+
+void StochasticTrackEngine::buildStepCache(stochastic_cache::StepCache &cache, const StochasticSequence &seq) const {
     auto &trk = stochasticTrack();
-    uint32_t divisor = effectiveDivisor();
+    uint32_t divisor = effectiveDivisor(seq);
     // Scale + rootNote are passed so the cache can bake melody-domain picks
     // (anchor pitches in Loop melody, cluster-tail Generate-mode pitches).
     const auto &scale = seq.selectedScale(_model.project().scale(), _model.project().scaleRotate());
     int rootNote = seq.selectedRootNote(_model.project().rootNote());
     stochastic_cache::rebuildStepCache(
-        _stepCache, seq, divisor, seq.rhythmSeed(), &scale, &trk, rootNote,
+        cache, seq, divisor, seq.rhythmSeed(), &scale, &trk, rootNote,
         _capturedFromLiveRhythm, _capturedFromLiveMelody);
 }
 
+// Identity of everything buildStepCache() reads: the stored sequence plus the
+// routed values that are not part of it.
+uint32_t StochasticTrackEngine::stepCacheKey(const StochasticSequence &seq) const {
+    FnvHash hash;
+    hash(&seq, sizeof(seq));
+    uint8_t knobs[kShapingKnobCount];
+    readShapingKnobs(seq, knobs);
+    hash(knobs, sizeof(knobs));
+    const auto &project = _model.project();
+    int32_t values[] = {
+        int32_t(seq.rest()),
+        int32_t(seq.slide()),
+        int32_t(effectiveDivisor(seq)),
+        ScaleResolve::resolveScale(seq.scale(), seq.trackIndex(), project.scale()),
+        seq.scaleRotate() < 0 ? project.scaleRotate() : seq.scaleRotate(),
+        seq.selectedRootNote(project.rootNote()),
+        int32_t(_capturedFromLiveRhythm) | int32_t(_capturedFromLiveMelody) << 1,
+    };
+    hash(values, sizeof(values));
+    return hash.result();
+}
+
 uint32_t StochasticTrackEngine::effectiveDivisor() const {
-    const auto &seq = sequence();
+    return effectiveDivisor(sequence());
+}
+
+uint32_t StochasticTrackEngine::effectiveDivisor(const StochasticSequence &seq) const {
     float clockMult = seq.clockMultiplier() * 0.01f;
     if (clockMult <= 0.f) clockMult = 1.f;
     uint32_t divisor = uint32_t(seq.divisor()) * (CONFIG_PPQN / CONFIG_SEQUENCE_PPQN);
@@ -852,7 +943,10 @@ uint32_t StochasticTrackEngine::effectiveDivisor() const {
 }
 
 void StochasticTrackEngine::readShapingKnobs(uint8_t out[kShapingKnobCount]) const {
-    const auto &seq = sequence();
+    readShapingKnobs(sequence(), out);
+}
+
+void StochasticTrackEngine::readShapingKnobs(const StochasticSequence &seq, uint8_t out[kShapingKnobCount]) const {
     out[size_t(ShapingKnob::NoteDuration)]  = uint8_t(seq.noteDuration());
     out[size_t(ShapingKnob::Variation)]     = uint8_t(seq.variation());
     out[size_t(ShapingKnob::Burst)]         = uint8_t(seq.burst());
@@ -2,7 +2,7 @@
 
 #include "TrackEngine.h"
 #include "SequenceState.h"
-#include "SortedQueue.h"
+#include "TimingWheel.h"
 #include "RecordHistory.h"
 #include "StepRecorder.h"
 #include "StochasticCache.h"
@@ -31,20 +31,10 @@ public:
         return _cvOutput;
     }
 
-    virtual void changePattern() override {
-        _sequence = &(_stochasticTrack.sequence(pattern()));
-
-        // In-flight queue entries targeted the previous sequence's timing/CV;
-        // discard them on pattern switch.
-        _gateQueue.clear();
-        _cvQueue.clear();
-        _patternCycleEnded = false;
-        _lastStepContentValid = false;
-        clearDirectHistory();
-        // Cache is per-track and was built for the previous pattern's events;
-        // rebuild for the new pattern.
-        refreshStepCache();
-    }
+    virtual uint32_t eventQueueOverflows() const override { return _gateQueue.overflows() + _cvQueue.overflows(); }
+
+    virtual void changePattern() override;
+    virtual void preparePattern(int pattern) override;
 
     int currentStep() const { return _currentStep; }
     bool activity() const override { return _activity; }
@@ -60,6 +50,7 @@ public:
     // edit paths that change cache-baked shaping fields so non-Repeat
     // playback picks up the new shape on the next trigger.
     void refreshStepCacheNow() { refreshStepCache(); }
+    const stochastic_cache::StepCache &stepCache() const { return _stepCache; }
     int lastDegree() const { return _lastDegree; }
     int lastDurationIndex() const { return _lastDurationIndex; }
     uint16_t loopCycleCount() const { return _loopCycleCount; }
@@ -142,6 +133,7 @@ private:
     // Sequence divisor scaled by clockMultiplier + PPQN conversion. Same
     // value flows to tick() and refreshStepCache().
     uint32_t effectiveDivisor() const;
+    uint32_t effectiveDivisor(const StochasticSequence &seq) const;
 
     void triggerStep(uint32_t tick, uint32_t divisor);
     void resetMeasure();
@@ -165,6 +157,11 @@ private:
     void writeLiveMelodyShadow(int stepIndex, const StochasticStepContent &melody);
     // Rebuild the engine cache from current sequence content.
     void refreshStepCache();
+    // Bring the cache up to date after a pattern switch or restart: no-op if
+    // the key is unchanged, adopts a matching prepared cache, rebuilds otherwise.
+    void updateStepCache();
+    void buildStepCache(stochastic_cache::StepCache &cache, const StochasticSequence &seq) const;
+    uint32_t stepCacheKey(const StochasticSequence &seq) const;
     void clearDirectHistory();
     void recordDirectHistory(float cv, bool rest, bool gate, uint8_t children);
 
@@ -232,6 +229,7 @@ private:
     };
     static constexpr size_t kShapingKnobCount = size_t(ShapingKnob::Count);
     void readShapingKnobs(uint8_t out[kShapingKnobCount]) const;
+    void readShapingKnobs(const StochasticSequence &seq, uint8_t out[kShapingKnobCount]) const;
 
     uint8_t _shapingSnapshot[kShapingKnobCount] = {};
     bool    _shapingSnapshotValid = false;
@@ -252,13 +250,7 @@ private:
         bool gate;
     };
 
-    struct GateCompare {
-        bool operator()(const Gate &a, const Gate &b) {
-            return a.tick < b.tick;
-        }
-    };
-
-    SortedQueue<Gate, 16, GateCompare> _gateQueue;
+    TimingWheel<Gate, 16> _gateQueue;
 
     struct Cv {
         uint32_t tick;
@@ -266,20 +258,17 @@ private:
         bool slide;
     };
 
-    struct CvCompare {
-        bool operator()(const Cv &a, const Cv &b) {
-            return a.tick < b.tick;
-        }
-    };
-
-    SortedQueue<Cv, 16, CvCompare> _cvQueue;
+    TimingWheel<Cv, 16> _cvQueue;
 
     // Playback-ready cells materialized from the events array. Engine reads
     // runtimeSteps[K] for each played step; rebuilt on edit / mutation / renew.
     stochastic_cache::StepCache _stepCache{};
+    // stepCacheKey() of the content _stepCache was built from
+    uint32_t _stepCacheKey = 0;
+    bool _stepCacheKeyValid = false;
 };
 
 // Ceiling sized to absorb the engine cache (RuntimeStep[64] + CellAux[64] +
 // housekeeping ≈ 390 B) while staying within the track-engine container
 // step. See PROJECT.md "Engine gate".
-static_assert(sizeof(StochasticTrackEngine) <= 1024, "StochasticTrackEngine too large");
+static_assert(sizeof(StochasticTrackEngine) <= 944, "StochasticTrackEngine too large (TeletypeTrackEngine at 944 is the container limit)");
@@ -103,34 +103,32 @@ void TT2MiniTrackEngine::sampleInputs() {
     }
 }
 
-// --- UI live-exec / trigger (host-scoped + engine-locked) ---
+// --- UI live-exec / trigger (host-scoped, applied on the engine task) ---
 
 void TT2MiniTrackEngine::triggerScript(int scriptIndex) {
     if (scriptIndex < 0 || scriptIndex >= TT2ConfigMini::ScriptCount) {
         return;
     }
-    _engine.lock();
-    {
+    _engine.invoke([&] () {
         ScopedHost host(this);
         runScript(uint8_t(scriptIndex));
-    }
-    _engine.unlock();
+    });
 }
 
 void TT2MiniTrackEngine::toggleScriptMute(int scriptIndex) {
     if (scriptIndex < 0 || scriptIndex >= TT2ConfigMini::TriggerInputCount) {
         return;
     }
-    _engine.lock();
-    _miniTrack.runtime().variables.mutes ^= uint8_t(1 << scriptIndex);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        _miniTrack.runtime().variables.mutes ^= uint8_t(1 << scriptIndex);
+    });
 }
 
 void TT2MiniTrackEngine::toggleMetroActive() {
-    _engine.lock();
-    auto &mAct = _miniTrack.runtime().variables.m_act;
-    mAct = mAct ? 0 : 1;
-    _engine.unlock();
+    _engine.invoke([&] () {
+        auto &mAct = _miniTrack.runtime().variables.m_act;
+        mAct = mAct ? 0 : 1;
+    });
 }
 
 // --- TT2Host: live engine / cross-track access for W*/BUS/RT ops ---
@@ -45,6 +45,34 @@ bool isBlankLine(const char *s) {
 
 enum Section { SEC_NONE, SEC_SCRIPT, SEC_PAT, SEC_TI, SEC_CI, SEC_CO, SEC_UNKNOWN };
 
+// Scene image header. Bump ImageVersion whenever TeletypeProgramT or the
+// lowering output changes without changing the program size.
+struct SceneImageHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t scriptCount;
+    uint8_t patternCount;
+    uint32_t programSize;
+    uint32_t textHash;
+    uint32_t imageHash;
+};
+
+static constexpr uint32_t ImageMagic = 0x43325454;  // 'TT2C'
+static constexpr uint16_t ImageVersion = 1;
+
+template<typename Cfg>
+SceneImageHeader imageHeader(uint32_t textHash) {
+    SceneImageHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = ImageMagic;
+    header.version = ImageVersion;
+    header.scriptCount = uint8_t(Cfg::ScriptCount);
+    header.patternCount = uint8_t(Cfg::PatternCount);
+    header.programSize = uint32_t(sizeof(TeletypeProgramT<Cfg>));
+    header.textHash = textHash;
+    return header;
+}
+
 } // namespace
 
 template<typename Cfg>
@@ -250,6 +278,65 @@ bool tt2DeserializeScript(TeletypeProgramT<Cfg> &p, int scriptIndex, Tt2SceneRea
     return loadScriptText(p, scriptIndex, buf) >= 0;
 }
 
+template<typename Cfg>
+void tt2SceneContent(const TeletypeProgramT<Cfg> &p, TeletypeProgramT<Cfg> &staging) {
+    init(staging);
+
+    for (int s = 0; s < Cfg::ScriptCount; ++s) {
+        const TT2Script &sc = p.scripts[s];
+        TT2Script &dst = staging.scripts[s];
+        dst.length = sc.length > TT2_COMMANDS_PER_SCRIPT ? TT2_COMMANDS_PER_SCRIPT : sc.length;
+        for (int l = 0; l < dst.length; ++l) {
+            // The printer drops the comment flag and anything past the length.
+            const TT2Command &cmd = sc.commands[l];
+            TT2Command &out = dst.commands[l];
+            out.length = cmd.length > TT2_COMMAND_MAX_LENGTH ? TT2_COMMAND_MAX_LENGTH : cmd.length;
+            for (int i = 0; i < out.length; ++i) {
+                out.tag[i] = cmd.tag[i];
+                out.value[i] = cmd.value[i];
+            }
+        }
+    }
+
+    for (int b = 0; b < Cfg::PatternCount; ++b) {
+        staging.patterns[b].len = p.patterns[b].len;
+        staging.patterns[b].wrap = p.patterns[b].wrap;
+        staging.patterns[b].start = p.patterns[b].start;
+        staging.patterns[b].end = p.patterns[b].end;
+        std::memcpy(staging.patterns[b].val, p.patterns[b].val, sizeof(p.patterns[b].val));
+    }
+
+    std::memcpy(staging.triggerSource, p.triggerSource, sizeof(p.triggerSource));
+    std::memcpy(staging.cvInputSource, p.cvInputSource, sizeof(p.cvInputSource));
+    std::memcpy(staging.cvOutputRange, p.cvOutputRange, sizeof(p.cvOutputRange));
+    std::memcpy(staging.cvOutputOffset, p.cvOutputOffset, sizeof(p.cvOutputOffset));
+    std::memcpy(staging.cvOutputQuantizeScale, p.cvOutputQuantizeScale, sizeof(p.cvOutputQuantizeScale));
+    std::memcpy(staging.cvOutputRootNote, p.cvOutputRootNote, sizeof(p.cvOutputRootNote));
+}
+
+template<typename Cfg>
+bool tt2WriteSceneImage(const TeletypeProgramT<Cfg> &p, uint32_t textHash, Tt2SceneWrite w, void *c) {
+    SceneImageHeader header = imageHeader<Cfg>(textHash);
+    header.imageHash = tt2TextHash(Tt2TextHashSeed, &p, sizeof(p));
+    w(c, reinterpret_cast<const char *>(&header), sizeof(header));
+    w(c, reinterpret_cast<const char *>(&p), sizeof(p));
+    return true;
+}
+
+template<typename Cfg>
+bool tt2ReadSceneImage(TeletypeProgramT<Cfg> &p, uint32_t textHash, Tt2ImageRead r, void *c) {
+    SceneImageHeader header;
+    if (!r(c, &header, sizeof(header))) return false;
+    SceneImageHeader expected = imageHeader<Cfg>(textHash);
+    if (header.magic != expected.magic || header.version != expected.version ||
+        header.scriptCount != expected.scriptCount || header.patternCount != expected.patternCount ||
+        header.programSize != expected.programSize || header.textHash != expected.textHash) {
+        return false;
+    }
+    if (!r(c, &p, sizeof(p))) return false;
+    return tt2TextHash(Tt2TextHashSeed, &p, sizeof(p)) == header.imageHash;
+}
+
 template bool tt2SerializeScene<TT2ConfigFull>(const TeletypeProgramT<TT2ConfigFull> &, Tt2SceneWrite, void *);
 template bool tt2DeserializeScene<TT2ConfigFull>(TeletypeProgramT<TT2ConfigFull> &, Tt2SceneRead, void *);
 template bool tt2SerializeScript<TT2ConfigFull>(const TeletypeProgramT<TT2ConfigFull> &, int, Tt2SceneWrite, void *);
@@ -259,3 +346,11 @@ template bool tt2SerializeScene<TT2ConfigMini>(const TeletypeProgramT<TT2ConfigM
 template bool tt2DeserializeScene<TT2ConfigMini>(TeletypeProgramT<TT2ConfigMini> &, Tt2SceneRead, void *);
 template bool tt2SerializeScript<TT2ConfigMini>(const TeletypeProgramT<TT2ConfigMini> &, int, Tt2SceneWrite, void *);
 template bool tt2DeserializeScript<TT2ConfigMini>(TeletypeProgramT<TT2ConfigMini> &, int, Tt2SceneRead, void *);
+
+template void tt2SceneContent<TT2ConfigFull>(const TeletypeProgramT<TT2ConfigFull> &, TeletypeProgramT<TT2ConfigFull> &);
+template void tt2SceneContent<TT2ConfigMini>(const TeletypeProgramT<TT2ConfigMini> &, TeletypeProgramT<TT2ConfigMini> &);
+
+template bool tt2WriteSceneImage<TT2ConfigFull>(const TeletypeProgramT<TT2ConfigFull> &, uint32_t, Tt2SceneWrite, void *);
+template bool tt2ReadSceneImage<TT2ConfigFull>(TeletypeProgramT<TT2ConfigFull> &, uint32_t, Tt2ImageRead, void *);
+template bool tt2WriteSceneImage<TT2ConfigMini>(const TeletypeProgramT<TT2ConfigMini> &, uint32_t, Tt2SceneWrite, void *);
+template bool tt2ReadSceneImage<TT2ConfigMini>(TeletypeProgramT<TT2ConfigMini> &, uint32_t, Tt2ImageRead, void *);
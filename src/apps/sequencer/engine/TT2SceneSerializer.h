@@ -3,6 +3,7 @@
 #include "model/TeletypeProgram.h"
 
 #include <cstddef>
+#include <cstdint>
 
 // Streaming read/write of a TeletypeProgram as an upstream-compatible teletype
 // scene .txt (sections #1-#8 / #M / #I scripts, #P patterns) plus appended TT2
@@ -37,3 +38,35 @@ template<typename Cfg>
 bool tt2SerializeScript(const TeletypeProgramT<Cfg> &program, int scriptIndex, Tt2SceneWrite write, void *ctx);
 template<typename Cfg>
 bool tt2DeserializeScript(TeletypeProgramT<Cfg> &program, int scriptIndex, Tt2SceneRead read, void *ctx);
+
+// Precompiled scene image: a binary copy of the lowered program, stored next to
+// the scene text so loads can skip parse/lowering. The image is keyed by a hash
+// of the scene text it was lowered from; a stale or foreign image (other hash,
+// other config, other layout version) is rejected and the caller falls back to
+// parsing the text.
+
+// Read exactly `len` bytes into data, false on short read or I/O error.
+using Tt2ImageRead = bool (*)(void *ctx, void *data, size_t len);
+
+// FNV-1a hash of scene text, fed incrementally. Start with Tt2TextHashSeed.
+static constexpr uint32_t Tt2TextHashSeed = 0x811c9dc5;
+inline uint32_t tt2TextHash(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    while (len-- > 0) {
+        hash = (hash ^ *src++) * 0x1000193;
+    }
+    return hash;
+}
+
+// Copy what the scene text carries of `program` into `staging` and leave the
+// rest at defaults, so `staging` equals the parse of the serialized text. Lets
+// a save write the image without reading its text back.
+template<typename Cfg>
+void tt2SceneContent(const TeletypeProgramT<Cfg> &program, TeletypeProgramT<Cfg> &staging);
+
+template<typename Cfg>
+bool tt2WriteSceneImage(const TeletypeProgramT<Cfg> &program, uint32_t textHash, Tt2SceneWrite write, void *ctx);
+// Fills `staging` only if the image matches textHash and this build's program
+// layout. Returns false otherwise; staging is then undefined.
+template<typename Cfg>
+bool tt2ReadSceneImage(TeletypeProgramT<Cfg> &staging, uint32_t textHash, Tt2ImageRead read, void *ctx);
@@ -121,17 +121,15 @@ void TT2TrackEngine::sampleInputs() {
     }
 }
 
-// --- UI live-exec / trigger (host-scoped + engine-locked) ---
+// --- UI live-exec / trigger (host-scoped, applied on the engine task) ---
 
 TT2EvalResult TT2TrackEngine::runLiveCommand(const TT2Command &cmd) {
-    _engine.lock();
     TT2EvalResult result;
-    {
+    _engine.invoke([&] () {
         ScopedHost host(this);
         _tt2Track.runtime().loopOps = 0;   // fresh op budget for the live line
         result = evaluateCommand(cmd, _tt2Track.runtime(), _output, &_tt2Track.program());
-    }
-    _engine.unlock();
+    });
     return result;
 }
 
@@ -139,28 +137,26 @@ void TT2TrackEngine::triggerScript(int scriptIndex) {
     if (scriptIndex < 0 || scriptIndex >= TT2_SCRIPT_COUNT) {
         return;
     }
-    _engine.lock();
-    {
+    _engine.invoke([&] () {
         ScopedHost host(this);
         runScript(uint8_t(scriptIndex));
-    }
-    _engine.unlock();
+    });
 }
 
 void TT2TrackEngine::toggleScriptMute(int scriptIndex) {
     if (scriptIndex < 0 || scriptIndex >= TT2_TRIGGER_INPUTS) {
         return;
     }
-    _engine.lock();
-    _tt2Track.runtime().variables.mutes ^= uint8_t(1 << scriptIndex);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        _tt2Track.runtime().variables.mutes ^= uint8_t(1 << scriptIndex);
+    });
 }
 
 void TT2TrackEngine::toggleMetroActive() {
-    _engine.lock();
-    auto &mAct = _tt2Track.runtime().variables.m_act;
-    mAct = mAct ? 0 : 1;
-    _engine.unlock();
+    _engine.invoke([&] () {
+        auto &mAct = _tt2Track.runtime().variables.m_act;
+        mAct = mAct ? 0 : 1;
+    });
 }
 
 // --- TT2Host: live engine / cross-track access for W*/BUS/RT ops ---
@@ -136,14 +136,14 @@ public:
     }
 
     // UI live-exec / trigger entry points. Each installs this engine as the
-    // scoped host (so W*/BUS/MO/G resolve) AND holds Engine::lock() for the
-    // duration — the UI thread mutates runtime/output that engine update() also
-    // touches. Synchronous on the UI thread, mirroring the legacy live path.
-    // Defined in the .cpp (need the full Engine definition to lock).
+    // scoped host (so W*/BUS/MO/G resolve) AND runs via Engine::invoke() — the
+    // command mutates runtime/output that engine update() also touches, so it is
+    // applied on the engine task. Synchronous for the UI, mirroring the legacy
+    // live path. Defined in the .cpp (need the full Engine definition).
     TT2EvalResult runLiveCommand(const TT2Command &cmd);
     void triggerScript(int scriptIndex) override;
 
-    // UI-thread toggles (also hold Engine::lock()). Mute gates the trigger-input
+    // UI-thread toggles (also run via Engine::invoke()). Mute gates the trigger-input
     // script firing; metro-active gates the METRO tick (variables.m_act).
     void toggleScriptMute(int scriptIndex) override;
     void toggleMetroActive() override;
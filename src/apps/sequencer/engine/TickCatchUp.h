@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+
+#include <cstdint>
+
+// Decides how many pending clock ticks the engine processes in a frame. When
+// the engine task is released late (long file or USB bursts), ticks queue up
+// in the clock. Processing all of them in one frame bunches gates and CV
+// changes into a single output update. Spreading the backlog over a few frames
+// keeps the spacing of the outputs but runs a few frames behind until caught up.
+class TickCatchUp {
+public:
+    enum class Policy : uint8_t {
+        Burst,      // process the whole backlog in one frame
+        Spread,     // process the regular ticks plus a share of the backlog, spread over SpreadFrames frames
+        Collapse,   // process the whole backlog but recompute outputs only once per frame
+        Last
+    };
+
+    static const char *policyName(Policy policy) {
+        switch (policy) {
+        case Policy::Burst:     return "Burst";
+        case Policy::Spread:    return "Spread";
+        case Policy::Collapse:  return "Collapse";
+        case Policy::Last:      break;
+        }
+        return nullptr;
+    }
+
+    static constexpr uint32_t SpreadFrames = 4;
+    static constexpr uint32_t Unlimited = UINT32_MAX;
+
+    Policy policy() const { return _policy; }
+    void setPolicy(Policy policy) { _policy = policy; }
+
+    // begin a frame with the number of ticks pending in the clock, the time since
+    // the last frame and the regular frame period, returns the number of ticks to process
+    uint32_t begin(uint32_t pending, uint32_t intervalUs, uint32_t periodUs) {
+        // ticks left over from the last frame are still pending, the rest arrived since
+        uint32_t arrived = pending > _deferred ? pending - _deferred : 0;
+
+        uint32_t limit = Unlimited;
+        switch (_policy) {
+        case Policy::Burst:
+            break;
+        case Policy::Spread: {
+            // ticks due in a regular frame at the current tick rate
+            uint32_t regular = intervalUs > periodUs ? uint32_t((uint64_t(arrived) * periodUs + intervalUs - 1) / intervalUs) : arrived;
+            if (regular < 1) {
+                regular = 1;
+            }
+            // the backlog is worked off at a constant share per frame, so it is cleared
+            // within SpreadFrames frames of the largest backlog seen
+            if (pending > regular) {
+                _share = std::max(_share, (pending - regular + SpreadFrames - 1) / SpreadFrames);
+            } else {
+                _share = 0;
+            }
+            limit = regular + _share;
+            break;
+        }
+        case Policy::Collapse:
+            limit = pending;
+            break;
+        case Policy::Last:
+            break;
+        }
+
+        _deferred = pending > limit ? pending - limit : 0;
+        return limit;
+    }
+
+    // ticks left for the following frames
+    uint32_t deferred() const { return _deferred; }
+
+    // true if the per-tick output recompute can be skipped because more ticks of the frame follow
+    bool collapse(uint32_t remaining) const {
+        return _policy == Policy::Collapse && remaining > 0;
+    }
+
+private:
+    Policy _policy = Policy::Spread;
+    uint32_t _deferred = 0;
+    uint32_t _share = 0;
+};
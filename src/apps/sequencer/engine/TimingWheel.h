@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+// Tick-keyed event queue for track engine gate/CV/note events.
+//
+// Hashed timing wheel: events live in a fixed pool of Capacity nodes and are
+// chained into bucket (tick % Slots). Chains are kept in tick order with equal
+// ticks in push order, so events due on the same tick come out in the order
+// they were scheduled. An occupancy mask finds the next non-empty bucket
+// without walking the wheel. Pushing an event up to Slots ticks ahead appends
+// to its bucket in O(1), events further ahead share the bucket with earlier
+// laps and are insert-sorted into the (short) chain.
+//
+// Drop-in for SortedQueue with a tick member: when the pool is full the oldest
+// (earliest) event is dropped, as with SortedQueue, and counted in overflows()
+// so lost events show up in the UI instead of going unnoticed.
+//
+// Node links, bucket heads/tails and the occupancy mask are 8/16 bit, so the
+// wheel only costs about Capacity + 2 * Slots + 16 bytes on top of the events.
+//
+// T must have a `uint32_t tick` member.
+template<typename T, size_t Capacity, size_t Slots = 8>
+class TimingWheel {
+    static_assert(Capacity > 0 && Capacity < 255, "capacity must fit node indices");
+    static_assert(Slots >= 2 && Slots <= 16 && (Slots & (Slots - 1)) == 0, "slots must be a power of two up to 16");
+
+public:
+    TimingWheel() {
+        clear();
+    }
+
+    // drop all pending events (overflow count is kept)
+    void clear() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            _next[i] = i + 1 < Capacity ? uint8_t(i + 1) : None;
+        }
+        _free = 0;
+        _occupied = 0;
+        _size = 0;
+        _front = None;
+        _cursor = 0;
+    }
+
+    size_t capacity() const { return Capacity; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const T &front() const { return _items[_front]; }
+          T &front()       { return _items[_front]; }
+
+    void push(const T &value) {
+        if (_free == None) {
+            ++_overflows;
+            pop();
+        }
+
+        uint8_t node = _free;
+        _free = _next[node];
+        _items[node] = value;
+        _next[node] = None;
+
+        uint32_t tick = value.tick;
+        size_t bucket = tick & (Slots - 1);
+        if (!(_occupied & (1u << bucket))) {
+            _head[bucket] = _tail[bucket] = node;
+            _occupied |= 1u << bucket;
+        } else if (_items[_tail[bucket]].tick <= tick) {
+            _next[_tail[bucket]] = node;
+            _tail[bucket] = node;
+        } else if (tick < _items[_head[bucket]].tick) {
+            _next[node] = _head[bucket];
+            _head[bucket] = node;
+        } else {
+            uint8_t prev = _head[bucket];
+            while (_items[_next[prev]].tick <= tick) {
+                prev = _next[prev];
+            }
+            _next[node] = _next[prev];
+            _next[prev] = node;
+        }
+        ++_size;
+
+        if (_size == 1 || tick < _cursor) {
+            _cursor = tick;
+        }
+        if (_front == None || tick < _items[_front].tick) {
+            _front = node;
+        }
+    }
+
+    // cancel all events after the pushed one, then push it (same contract as SortedQueue::pushReplace)
+    void pushReplace(const T &value) {
+        cancelAfter(value.tick);
+        push(value);
+    }
+
+    void pop() {
+        if (_size == 0) {
+            return;
+        }
+        uint8_t node = _front;
+        size_t bucket = _items[node].tick & (Slots - 1);
+        _head[bucket] = _next[node];
+        if (_head[bucket] == None) {
+            _occupied &= ~(1u << bucket);
+        }
+        _cursor = _items[node].tick;
+        release(node);
+        --_size;
+        _front = findFront();
+    }
+
+    // cancel all events scheduled after tick
+    void cancelAfter(uint32_t tick) {
+        uint32_t occupied = _occupied;
+        while (occupied) {
+            size_t bucket = ctz(occupied);
+            occupied &= occupied - 1;
+
+            uint8_t node = _head[bucket];
+            if (_items[node].tick > tick) {
+                releaseChain(node);
+                _occupied &= ~(1u << bucket);
+                continue;
+            }
+            while (_next[node] != None && _items[_next[node]].tick <= tick) {
+                node = _next[node];
+            }
+            releaseChain(_next[node]);
+            _next[node] = None;
+            _tail[bucket] = node;
+        }
+        _front = findFront();
+    }
+
+    // number of events dropped because the queue was full
+    uint32_t overflows() const { return _overflows; }
+    void resetOverflows() { _overflows = 0; }
+
+private:
+    static constexpr uint8_t None = 0xff;
+
+    static size_t ctz(uint32_t value) {
+        return size_t(__builtin_ctz(value));
+    }
+
+    void release(uint8_t node) {
+        _next[node] = _free;
+        _free = node;
+    }
+
+    void releaseChain(uint8_t node) {
+        while (node != None) {
+            uint8_t next = _next[node];
+            release(node);
+            --_size;
+            node = next;
+        }
+    }
+
+    // Chain heads are the earliest events of their bucket. Scanning from the
+    // cursor (a lower bound of all pending ticks), the first head that is due
+    // within one lap is the earliest event overall. Only if every pending event
+    // is more than a lap ahead all heads are compared.
+    uint8_t findFront() {
+        if (_occupied == 0) {
+            return None;
+        }
+        size_t start = _cursor & (Slots - 1);
+        uint32_t occupied = _occupied;
+        uint32_t rotated = ((occupied >> start) | (occupied << (Slots - start))) & ((1u << Slots) - 1);
+        uint8_t best = None;
+        while (rotated) {
+            size_t offset = ctz(rotated);
+            rotated &= rotated - 1;
+            uint8_t head = _head[(start + offset) & (Slots - 1)];
+            if (_items[head].tick == _cursor + offset) {
+                return head;
+            }
+            if (best == None || _items[head].tick < _items[best].tick) {
+                best = head;
+            }
+        }
+        _cursor = _items[best].tick;
+        return best;
+    }
+
+    std::array<T, Capacity> _items;
+    uint8_t _next[Capacity];
+    uint8_t _head[Slots];
+    uint8_t _tail[Slots];
+    uint16_t _occupied;
+    uint8_t _free;
+    uint8_t _front;
+    uint8_t _size;
+    uint32_t _cursor;
+    uint32_t _overflows = 0;
+};
@@ -57,11 +57,21 @@ public:
     virtual void reset() = 0;
     virtual void restart() = 0;
     virtual TickResult tick(uint32_t tick) = 0;
+    // Returns the first tick >= the given tick at which tick() has to be called.
+    // The engine skips calling tick() on this track until then. The result is
+    // re-evaluated after every tick() and at the start of every engine update, so it
+    // only has to be exact with respect to state changed by tick() itself. Returning
+    // a tick too early is always safe, the default runs the engine on every tick.
+    virtual uint32_t nextTick(uint32_t tick) const { return tick; }
     virtual void update(float dt) = 0;
     // Optional hook to drop gates/cleanup when transport stops
     virtual void stop() {}
 
     virtual void changePattern() {}
+    // Precompute derived state for `pattern` ahead of a pattern switch. Called by
+    // the engine in the frames before the switch, changePattern() adopts the
+    // result if it is still valid.
+    virtual void preparePattern(int pattern) {}
 
     // UI-control hooks (Seam-2): Teletype engines override; default no-ops so the
     // script page can drive any engine through a TrackEngine& without a cast.
@@ -86,6 +96,9 @@ public:
 
     virtual float sequenceProgress() const { return -1.f; }
 
+    // number of scheduled gate/cv events dropped because an event queue was full
+    virtual uint32_t eventQueueOverflows() const { return 0; }
+
     // helpers
 
     bool isSelected() const { return _model.project().selectedTrackIndex() == _track.trackIndex(); }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "TrackEngine.h"
+#include "NoteTrackEngine.h"
+#include "CurveTrackEngine.h"
+#include "MidiCvTrackEngine.h"
+#include "TuesdayTrackEngine.h"
+#include "DiscreteMapTrackEngine.h"
+#include "IndexedTrackEngine.h"
+#include "StochasticTrackEngine.h"
+#include "FractalTrackEngine.h"
+#include "PhaseFluxTrackEngine.h"
+#include "TT2TrackEngine.h"
+#include "TT2MiniTrackEngine.h"
+
+#include "model/Track.h"
+
+// Static dispatch over the concrete track engine types.
+//
+// Calls the visitor with the engine cast to its concrete (final) type, so the
+// engine's hot per-tick calls resolve at compile time instead of going through
+// the vtable. `trackMode` must be the mode the engine was created for (not the
+// model's track mode, which can change before the engine is re-created). The
+// virtual TrackEngine interface stays the way the UI talks to engines.
+//
+// Visitors are functors with a templated call operator:
+//
+//   struct Visitor {
+//       template<typename T> void operator()(T &trackEngine) { ... }
+//   };
+template<typename Visitor>
+inline void visitTrackEngine(Track::TrackMode trackMode, TrackEngine &trackEngine, Visitor &visitor) {
+    switch (trackMode) {
+    case Track::TrackMode::Note:         visitor(static_cast<NoteTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Curve:        visitor(static_cast<CurveTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::MidiCv:       visitor(static_cast<MidiCvTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Tuesday:      visitor(static_cast<TuesdayTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::DiscreteMap:  visitor(static_cast<DiscreteMapTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Indexed:      visitor(static_cast<IndexedTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Stochastic:   visitor(static_cast<StochasticTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Fractal:      visitor(static_cast<FractalTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::PhaseFlux:    visitor(static_cast<PhaseFluxTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::TeletypeV2:   visitor(static_cast<TT2TrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::TeletypeMini: visitor(static_cast<TT2MiniTrackEngine &>(trackEngine)); break;
+    case Track::TrackMode::Last:         visitor(trackEngine); break;
+    }
+}
+
+template<typename Visitor>
+inline void visitTrackEngine(Track::TrackMode trackMode, const TrackEngine &trackEngine, Visitor &visitor) {
+    visitTrackEngine(trackMode, const_cast<TrackEngine &>(trackEngine), visitor);
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "Config.h"
+#include "GateRotation.h"
+
+#include "core/math/Math.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Composes the gate and CV jacks from the track engine outputs (see Engine::updateTrackOutputs()).
+//
+// Which track output feeds which jack only changes with the output mapping, the
+// track modes and the rotation groups, so it is resolved into a plan when one of
+// them changes: per jack the source track and output slot after rotation, the CV
+// route lane, masks of the jacks that are written and a mask of the TT2 tracks
+// that mix into every jack. Composing a frame is a straight pass over the jacks
+// with no pool searches or mapping branches.
+//
+// CV values stay float and go through the same operations in the same order as
+// before, so the composed outputs are bit-identical to the per-channel version.
+//
+// Source provides the values:
+//   bool gate(int track, int slot), float cv(int track, int slot),
+//   float cvRoute(int lane), float applyModulatorOffset(int channel, float cv)
+class TrackOutputComposer {
+public:
+    static constexpr int Channels = CONFIG_CHANNEL_COUNT;
+    static constexpr int Tracks = CONFIG_TRACK_COUNT;
+    static constexpr int CvRouteLanes = 4;
+
+    static_assert(Channels <= 8 && Tracks <= 8, "masks must fit into 8 bits");
+
+    struct Mapping {
+        uint8_t gateOutputTracks[Channels]; // track per gate jack, >= Tracks: none
+        uint8_t cvOutputTracks[Channels];   // track per CV jack, Tracks: CV route, > Tracks: none
+        uint8_t tt2Tracks;                  // mask of TT2 tracks (mixed into every jack by jack index)
+        uint8_t gateRotateMask;
+        uint8_t cvRotateMask;
+        int gateRotateAmount;
+        int cvRotateAmount;
+
+        bool operator==(const Mapping &other) const {
+            return std::memcmp(gateOutputTracks, other.gateOutputTracks, sizeof(gateOutputTracks)) == 0 &&
+                std::memcmp(cvOutputTracks, other.cvOutputTracks, sizeof(cvOutputTracks)) == 0 &&
+                tt2Tracks == other.tt2Tracks &&
+                gateRotateMask == other.gateRotateMask &&
+                cvRotateMask == other.cvRotateMask &&
+                gateRotateAmount == other.gateRotateAmount &&
+                cvRotateAmount == other.cvRotateAmount;
+        }
+        bool operator!=(const Mapping &other) const { return !(*this == other); }
+    };
+
+    TrackOutputComposer() {
+        std::memset(&_mapping, 0, sizeof(_mapping));
+        std::memset(_mapping.gateOutputTracks, 0xff, sizeof(_mapping.gateOutputTracks));
+        rebuild();
+    }
+
+    // update the plan if the mapping changed
+    void setMapping(const Mapping &mapping) {
+        if (mapping != _mapping) {
+            _mapping = mapping;
+            rebuild();
+        }
+    }
+
+    const Mapping &mapping() const { return _mapping; }
+
+    // returns gates with the driven jacks replaced
+    template<typename Source>
+    uint8_t composeGates(Source &source, uint8_t gates) const {
+        uint8_t written = _gateWritten;
+        while (written) {
+            int i = ctz(written);
+            written &= written - 1;
+            bool g = _gateSlot[i] >= 0 && source.gate(_gateTrack[i], _gateSlot[i]);
+            uint8_t tt2 = _mapping.tt2Tracks;
+            while (!g && tt2) {
+                int t = ctz(tt2);
+                tt2 &= tt2 - 1;
+                g = source.gate(t, i);
+            }
+            gates = g ? (gates | (1 << i)) : (gates & ~(1 << i));
+        }
+        return gates;
+    }
+
+    // writes the driven jacks of cv
+    template<typename Source>
+    void composeCv(Source &source, float *cv) const {
+        uint8_t written = _cvWritten;
+        while (written) {
+            int i = ctz(written);
+            written &= written - 1;
+            float cvBase = 0.f;
+            if (_cvSlot[i] >= 0) {
+                cvBase = source.cv(_cvTrack[i], _cvSlot[i]);
+            } else if (_cvLane[i] >= 0) {
+                cvBase = source.cvRoute(_cvLane[i]);
+            }
+            float v = source.applyModulatorOffset(i, cvBase);
+            float tt2Sum = 0.f;
+            uint8_t tt2 = _mapping.tt2Tracks;
+            while (tt2) {
+                int t = ctz(tt2);
+                tt2 &= tt2 - 1;
+                tt2Sum += source.cv(t, i);
+            }
+            cv[i] = clamp(v + tt2Sum, -5.f, 5.f);
+        }
+    }
+
+private:
+    static int ctz(uint8_t value) {
+        return __builtin_ctz(value);
+    }
+
+    bool isTt2(int track) const {
+        return _mapping.tt2Tracks & (1 << track);
+    }
+
+    // jacks of the rotation group, in jack order
+    int rotationPool(const uint8_t *outputTracks, uint8_t rotateMask, int8_t *pool) const {
+        int size = 0;
+        for (int i = 0; i < Channels; ++i) {
+            int track = outputTracks[i];
+            if (track < Tracks && !isTt2(track) && (rotateMask & (1 << track))) {
+                pool[size++] = i;
+            }
+        }
+        return size;
+    }
+
+    // jack whose mapping feeds jack i after rotation
+    static int rotatedSource(int i, const int8_t *pool, int poolSize, int amount) {
+        for (int k = 0; k < poolSize; ++k) {
+            if (pool[k] == i) {
+                return pool[rotatedGroupMember(k, amount, poolSize)];
+            }
+        }
+        return i;
+    }
+
+    void rebuild() {
+        int8_t pool[Channels];
+
+        // gates: output slots are handed out in jack order of the (rotated) sources
+        int gatePoolSize = rotationPool(_mapping.gateOutputTracks, _mapping.gateRotateMask, pool);
+        int trackGateIndex[Tracks] = {};
+        _gateWritten = 0;
+        for (int i = 0; i < Channels; ++i) {
+            int source = rotatedSource(i, pool, gatePoolSize, _mapping.gateRotateAmount);
+            int track = _mapping.gateOutputTracks[source];
+            _gateTrack[i] = -1;
+            _gateSlot[i] = -1;
+            if (track < Tracks) {
+                _gateWritten |= 1 << i;
+                _gateTrack[i] = track;
+                // a TT2 source resolves false, TT2 reaches the jack through the mix only
+                if (!isTt2(track)) {
+                    _gateSlot[i] = trackGateIndex[track]++;
+                }
+            }
+        }
+
+        // CV: output slots and route lanes are handed out in jack order of the mapping
+        int8_t cvSlot[Channels];
+        int8_t cvLane[Channels];
+        int trackCvIndex[Tracks] = {};
+        int lane = 0;
+        for (int i = 0; i < Channels; ++i) {
+            int track = _mapping.cvOutputTracks[i];
+            cvSlot[i] = -1;
+            cvLane[i] = -1;
+            if (track < Tracks) {
+                cvSlot[i] = trackCvIndex[track]++;
+            } else if (track == Tracks) {
+                cvLane[i] = lane++;
+            }
+        }
+
+        int cvPoolSize = rotationPool(_mapping.cvOutputTracks, _mapping.cvRotateMask, pool);
+        _cvWritten = 0;
+        for (int i = 0; i < Channels; ++i) {
+            int source = rotatedSource(i, pool, cvPoolSize, _mapping.cvRotateAmount);
+            int track = _mapping.cvOutputTracks[source];
+            _cvTrack[i] = -1;
+            _cvSlot[i] = -1;
+            _cvLane[i] = -1;
+            bool write = _mapping.tt2Tracks != 0;
+            if (track < Tracks) {
+                // a TT2 source contributes 0V, TT2 reaches the jack through the mix only
+                if (!isTt2(track)) {
+                    _cvTrack[i] = track;
+                    _cvSlot[i] = cvSlot[source];
+                }
+                write = true;
+            } else if (track == Tracks && cvLane[source] < CvRouteLanes) {
+                _cvLane[i] = cvLane[source];
+                write = true;
+            }
+            if (write) {
+                _cvWritten |= 1 << i;
+            }
+        }
+    }
+
+    Mapping _mapping;
+    int8_t _gateTrack[Channels];
+    int8_t _gateSlot[Channels];     // -1: source resolves false
+    int8_t _cvTrack[Channels];
+    int8_t _cvSlot[Channels];       // -1: no track source
+    int8_t _cvLane[Channels];       // -1: no CV route source
+    uint8_t _gateWritten;
+    uint8_t _cvWritten;
+};
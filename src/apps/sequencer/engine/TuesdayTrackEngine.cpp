@@ -4,6 +4,7 @@
 #include "model/Scale.h"
 
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 
 // Initialize algorithm state based on Flow (seed1) and Ornament (seed2)
@@ -20,6 +21,8 @@
 // This separation prevents unwanted correlation (e.g., slides always sync with accents).
 // Salt value (0x9e3779b9) ensures distinct sequences even when Flow == Ornament.
 void TuesdayTrackEngine::initAlgorithm() {
+    rewindLookAhead();
+
     const auto &_tuesdayTrackRef = tuesdayTrack();
     const auto &sequence = _tuesdayTrackRef.sequence(pattern());
     int flow = sequence.flow();
@@ -286,15 +289,20 @@ void TuesdayTrackEngine::initAlgorithm() {
         break;
     }
 }
+
+    resetLookAhead();
 }
 
 void TuesdayTrackEngine::reset() {
+    rewindLookAhead();
+
     _cachedFlow = -1;
     _cachedOrnament = -1;
     _cachedLoopLength = -1;
 
     _stepIndex = 0;
     _displayStep = -1;
+    _lookAheadLastStep = -1;
     _gateLength = 0;
     _gateTicks = 0;
     _coolDown = 0;
@@ -346,6 +354,9 @@ void TuesdayTrackEngine::restart() {
 }
 
 void TuesdayTrackEngine::reseed() {
+    // Derive the new seeds from the state of the last played step
+    rewindLookAhead();
+
     // Reset step to beginning
     _stepIndex = 0;
     _coolDown = 0;
@@ -523,6 +534,9 @@ void TuesdayTrackEngine::reseed() {
         _turingSR.seed(_rng.next());
         break;
 }
+
+    _lookAheadLastStep = -1;
+    resetLookAhead();
 }
 
 TuesdayTrackEngine::GenerationContext TuesdayTrackEngine::calculateContext(uint32_t tick) const {
@@ -1739,6 +1753,177 @@ TuesdayTrackEngine::TuesdayTickResult TuesdayTrackEngine::generateStep(uint32_t
     }
 }
 
+// Generates the step at _stepIndex and quantizes its voltages. The generators
+// only depend on the step index, the generator state and the inputs covered
+// by generationInputs(), so a step can be resolved ahead of its tick.
+void TuesdayTrackEngine::resolveStep(ResolvedStep &step) {
+    // calculateContext() does not use the tick
+    TuesdayTickResult result = generateStep(0);
+
+    step.stepIndex = _stepIndex;
+    step.volts = scaleToVolts(result.note, result.octave);
+    int offsets = std::min(8, int(std::max(result.polyCount, result.trillCount)));
+    for (int i = 0; i < offsets; ++i) {
+        step.offsetVolts[i] = scaleToVolts(result.note + result.noteOffsets[i], result.octave);
+    }
+    for (int i = offsets; i < 8; ++i) {
+        step.offsetVolts[i] = step.volts;
+    }
+    step.gateRatio = result.gateRatio;
+    step.velocity = result.velocity;
+    step.gateOffset = result.gateOffset;
+    step.trillCount = result.trillCount;
+    step.beatSpread = result.beatSpread;
+    step.polyCount = result.polyCount;
+    step.accent = result.accent;
+    step.slide = result.slide;
+    step.isSpatial = result.isSpatial;
+}
+
+// Note, octave and note offsets are only needed for the voltages, which are
+// already resolved.
+TuesdayTrackEngine::TuesdayTickResult TuesdayTrackEngine::ResolvedStep::result() const {
+    TuesdayTickResult result;
+    result.velocity = velocity;
+    result.accent = accent;
+    result.slide = slide;
+    result.gateRatio = gateRatio;
+    result.gateOffset = gateOffset;
+    result.trillCount = trillCount;
+    result.beatSpread = beatSpread;
+    result.polyCount = polyCount;
+    result.isSpatial = isSpatial;
+    return result;
+}
+
+void TuesdayTrackEngine::consumeStep(ResolvedStep &step) {
+    if (_lookAheadCount > 0) {
+        const auto &entry = _lookAhead[_lookAheadHead];
+        if (entry.step.stepIndex == _stepIndex && generationInputs() == _lookAheadInputs) {
+            step = entry.step;
+            _lookAheadHead = (_lookAheadHead + 1) % LookAheadSize;
+            --_lookAheadCount;
+            _lookAheadLastStep = _stepIndex;
+            return;
+        }
+        // stale ring, continue from the state after the last consumed step
+        rewindLookAhead();
+    }
+
+    resolveStep(step);
+    _lookAheadLastStep = _stepIndex;
+}
+
+void TuesdayTrackEngine::prefetchStep() {
+    if (!_lookAheadEnabled || _lookAheadCount >= LookAheadSize) {
+        return;
+    }
+
+    auto inputs = generationInputs();
+    if (_lookAheadCount > 0 && inputs != _lookAheadInputs) {
+        rewindLookAhead();
+    }
+    _lookAheadInputs = inputs;
+
+    int lastStep = _lookAheadCount > 0
+        ? _lookAhead[(_lookAheadHead + _lookAheadCount - 1) % LookAheadSize].step.stepIndex
+        : _lookAheadLastStep;
+    int nextStep = lastStep + 1;
+
+    // finite loops reinitialize the algorithm on wrap, nothing to generate beyond
+    int loopLength = tuesdayTrack().sequence(pattern()).actualLoopLength();
+    if (loopLength > 0 && nextStep >= loopLength) {
+        return;
+    }
+
+    auto &entry = _lookAhead[(_lookAheadHead + _lookAheadCount) % LookAheadSize];
+    saveCursor(entry.cursor);
+    int stepIndex = _stepIndex;
+    _stepIndex = nextStep;
+    resolveStep(entry.step);
+    _stepIndex = stepIndex;
+    ++_lookAheadCount;
+}
+
+void TuesdayTrackEngine::saveCursor(GeneratorCursor &cursor) const {
+    cursor.rng = _rng;
+    cursor.extraRng = _extraRng;
+    cursor.turingSR = _turingSR;
+    std::memcpy(cursor.algoState, &_algoState, AlgorithmCursorSize);
+}
+
+void TuesdayTrackEngine::restoreCursor(const GeneratorCursor &cursor) {
+    _rng = cursor.rng;
+    _extraRng = cursor.extraRng;
+    _turingSR = cursor.turingSR;
+    std::memcpy(&_algoState, cursor.algoState, AlgorithmCursorSize);
+}
+
+// Drops all generated-ahead steps and rewinds the generator to the state after
+// the last consumed step.
+void TuesdayTrackEngine::rewindLookAhead() {
+    if (_lookAheadCount > 0) {
+        restoreCursor(_lookAhead[_lookAheadHead].cursor);
+    }
+    _lookAheadHead = 0;
+    _lookAheadCount = 0;
+}
+
+// Drops all generated-ahead steps and keeps the live generator state (after
+// initAlgorithm/reseed reinitialized it).
+void TuesdayTrackEngine::resetLookAhead() {
+    _lookAheadHead = 0;
+    _lookAheadCount = 0;
+}
+
+bool TuesdayTrackEngine::GenerationInputs::operator==(const GenerationInputs &other) const {
+    return divisor == other.divisor &&
+        loopLength == other.loopLength &&
+        rotate == other.rotate &&
+        pattern == other.pattern &&
+        algorithm == other.algorithm &&
+        flow == other.flow &&
+        ornament == other.ornament &&
+        power == other.power &&
+        glide == other.glide &&
+        gateLength == other.gateLength &&
+        stepTrill == other.stepTrill &&
+        clockMultiplier == other.clockMultiplier &&
+        octave == other.octave &&
+        transpose == other.transpose &&
+        scale == other.scale &&
+        scaleRotate == other.scaleRotate &&
+        rootNote == other.rootNote;
+}
+
+// Routed values are read through the sequence getters, so modulation
+// invalidates the ring like an edit does.
+TuesdayTrackEngine::GenerationInputs TuesdayTrackEngine::generationInputs() const {
+    const auto &sequence = tuesdayTrack().sequence(pattern());
+    const auto &project = _model.project();
+    int trackIndex = _track.trackIndex();
+
+    GenerationInputs inputs;
+    inputs.divisor = sequence.divisor();
+    inputs.loopLength = sequence.actualLoopLength();
+    inputs.rotate = sequence.rotate();
+    inputs.pattern = pattern();
+    inputs.algorithm = sequence.algorithm();
+    inputs.flow = sequence.flow();
+    inputs.ornament = sequence.ornament();
+    inputs.power = sequence.power();
+    inputs.glide = sequence.glide();
+    inputs.gateLength = sequence.gateLength();
+    inputs.stepTrill = sequence.stepTrill();
+    inputs.clockMultiplier = sequence.clockMultiplier();
+    inputs.octave = sequence.octave();
+    inputs.transpose = sequence.transpose();
+    inputs.scale = ScaleResolve::resolveScale(sequence.scale(), trackIndex, project.scale());
+    inputs.scaleRotate = sequence.scaleRotate() < 0 ? project.scaleRotate() : sequence.scaleRotate();
+    inputs.rootNote = ScaleResolve::resolveRootNote(sequence.rootNote(), trackIndex, project.rootNote());
+    return inputs;
+}
+
 TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
     // Mute no longer early-returns: the algorithm advances every tick so a muted
     // track stays in sync. Mute gates only the physical outputs, applied in the
@@ -1903,6 +2088,7 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
     // Finite Loop Reset
     if (resetDivisor > 0 && relativeTick == 0) {
         initAlgorithm(); // Reset RNGs to loop start state
+        _lookAheadLastStep = -1;
         if (tuesdayTrack().playMode() == Types::PlayMode::Free) {
             _stepIndex = -1; // force step trigger on loop restart
         } else {
@@ -1993,7 +2179,10 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
         }
 
         // 1. GENERATE (The Brain)
-        TuesdayTickResult result = generateStep(tick);
+        // Usually pops a step generated ahead in update()
+        ResolvedStep step;
+        consumeStep(step);
+        TuesdayTickResult result = step.result();
         
         // Apply Algorithm's Timing Offset with User Scaler
         // Scaler Model:
@@ -2117,9 +2306,8 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
                     if (microgateAllowed) {
                         uint32_t offset = (i * spacing);
 
-                        // Calculate voltage for THIS gate using note offset
-                        int noteWithOffset = result.note + result.noteOffsets[i];
-                        float volts = scaleToVolts(noteWithOffset, result.octave);
+                        // Voltage for THIS gate using note offset (resolved with the step)
+                        float volts = step.offsetVolts[i];
 
                         _microGateQueue.push({ baseTick + offset, true, volts });
                         _microGateQueue.push({ baseTick + offset + gateLen, false, volts });
@@ -2202,8 +2390,8 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
                  gateLengthTicks = (gateLengthTicks * 3) / 2;
              }
 
-             // Calculate CV voltage
-             float volts = scaleToVolts(result.note, result.octave);
+             // CV voltage (resolved with the step)
+             float volts = step.volts;
 
              // Schedule gates in micro-queue (not immediate)
              // Skip if retrigger/polyrhythm will handle it
@@ -2236,7 +2424,7 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
              // Update CV anyway if Free mode?
              // BUT: Don't update on explicitly muted steps (velocity=0 from polyrhythm suppression)
              if (sequence.cvUpdateMode() == TuesdaySequence::Free && result.velocity > 0) {
-                  float volts = scaleToVolts(result.note, result.octave);
+                  float volts = step.volts;
                   _cvCurrent = volts;
                   _cvOutput = volts;
              }
@@ -2249,6 +2437,11 @@ TrackEngine::TickResult TuesdayTrackEngine::tick(uint32_t tick) {
 }
 
 void TuesdayTrackEngine::update(float dt) {
+    // Generate ahead on idle frames only (dt == 0 is the in-tick output recompute)
+    if (dt > 0.f) {
+        prefetchStep();
+    }
+
     // CV Slide Update
     if (_slideCountDown > 0) {
         _slideCountDown--;
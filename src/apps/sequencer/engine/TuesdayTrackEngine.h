@@ -8,6 +8,8 @@
 #include "SortedQueue.h"
 #include "generators/TuringRegister.h"
 
+#include <cstddef>
+
 class TuesdayTrackEngine final : public TrackEngine {
 public:
     TuesdayTrackEngine(Engine &engine, const Model &model, Track &track) :
@@ -57,6 +59,13 @@ public:
     // Current step index for UI display
     int currentStep() const { return _displayStep; }
 
+#ifndef PLATFORM_STM32
+    // Test seams for the look-ahead ring: generate every step on its tick
+    // instead (reference output), and the number of steps generated ahead.
+    void setLookAheadEnabledForTest(bool enabled) { rewindLookAhead(); _lookAheadEnabled = enabled; }
+    int lookAheadCountForTest() const { return _lookAheadCount; }
+#endif
+
 private:
     void initAlgorithm();
     
@@ -141,6 +150,88 @@ private:
     // The "Pipeline": Converts abstract algorithm steps into quantized voltage
     float scaleToVolts(int noteIndex, int octave) const;
 
+    // Look-ahead step cache
+    //
+    // Steps are generated ahead of time in update() (idle frames) into a small
+    // ring of resolved steps, so the step tick only pops a precomputed result
+    // instead of running the generator and scale quantization. Each entry keeps
+    // the generator state it was generated from: whenever the ring does not
+    // match (parameter edit, routed change, reseed, skipped step) the state of
+    // the oldest entry is restored and the step is generated synchronously as
+    // before.
+    static constexpr int LookAheadSize = 2;
+
+    // Bytes of AlgorithmState the generators mutate. Every state but Markov
+    // fits, Markov only advances its history and keeps the matrix set up by
+    // initAlgorithm()/reseed() at the end.
+    static constexpr int AlgorithmCursorSize = 24;
+
+    // Generator state a step was generated from
+    struct GeneratorCursor {
+        Random rng;
+        Random extraRng;
+        TuringRegister turingSR;
+        uint8_t algoState[AlgorithmCursorSize];
+    };
+
+    // The parts of an algorithm result the step tick reads, with its
+    // quantized voltages
+    struct ResolvedStep {
+        int stepIndex;
+        float volts;                // scaleToVolts(note, octave)
+        float offsetVolts[8];       // scaleToVolts(note + noteOffsets[i], octave)
+        uint16_t gateRatio;
+        uint8_t velocity;
+        uint8_t gateOffset;
+        uint8_t trillCount;
+        uint8_t beatSpread;
+        uint8_t polyCount;
+        bool accent : 1;
+        bool slide : 1;
+        bool isSpatial : 1;
+
+        TuesdayTickResult result() const;
+    };
+
+    struct LookAheadEntry {
+        ResolvedStep step;
+        GeneratorCursor cursor;     // state before generating this step
+    };
+
+    // Every input the generators and scaleToVolts() read besides the step index
+    // and the generator state, routed values included
+    struct GenerationInputs {
+        int16_t divisor;
+        int16_t loopLength;
+        int16_t rotate;
+        uint8_t pattern;
+        uint8_t algorithm;
+        uint8_t flow;
+        uint8_t ornament;
+        uint8_t power;
+        uint8_t glide;
+        uint8_t gateLength;
+        uint8_t stepTrill;
+        uint8_t clockMultiplier;
+        int8_t octave;
+        int8_t transpose;
+        int8_t scale;
+        int8_t scaleRotate;
+        int8_t rootNote;
+
+        bool operator==(const GenerationInputs &other) const;
+        bool operator!=(const GenerationInputs &other) const { return !(*this == other); }
+    };
+
+    void resolveStep(ResolvedStep &step);
+    void consumeStep(ResolvedStep &step);
+    void prefetchStep();
+    void saveCursor(GeneratorCursor &cursor) const;
+    void restoreCursor(const GeneratorCursor &cursor);
+    void rewindLookAhead();
+    void resetLookAhead();
+    GenerationInputs generationInputs() const;
+
     // Dual RNG system (matches original Tuesday)
     // _rng is seeded from seed1 (Flow) or seed2 (Ornament) depending on algorithm
     // _extraRng is seeded from the other parameter
@@ -178,6 +269,11 @@ private:
     // Gate offset from step start (as fraction of divisor, 0-100%)
     uint8_t _gateOffset = 0;  // Default 0% gate offset
 
+    // Look-ahead ring position (kept here to fill the padding before the queue)
+    uint8_t _lookAheadHead = 0;
+    uint8_t _lookAheadCount = 0;
+    bool _lookAheadEnabled = true;
+
     // Micro-gate queue for precise timing
     // Size 32: supports 7-tuplet (14 entries) with headroom for multiple beats
     SortedQueue<MicroGate, 32, MicroGateCompare> _microGateQueue;
@@ -315,9 +411,25 @@ private:
         GanzState ganz;
     };
 
+    // the look-ahead cursor saves the leading bytes of the state only
+    static_assert(sizeof(TestState) <= AlgorithmCursorSize && sizeof(TritranceState) <= AlgorithmCursorSize &&
+                  sizeof(StomperState) <= AlgorithmCursorSize && sizeof(AphexState) <= AlgorithmCursorSize &&
+                  sizeof(AutechreState) <= AlgorithmCursorSize && sizeof(StepwaveState) <= AlgorithmCursorSize &&
+                  sizeof(ChipArp1State) <= AlgorithmCursorSize && sizeof(ChipArp2State) <= AlgorithmCursorSize &&
+                  sizeof(WobbleState) <= AlgorithmCursorSize && sizeof(ScalewalkerState) <= AlgorithmCursorSize &&
+                  sizeof(WindowState) <= AlgorithmCursorSize && sizeof(MinimalState) <= AlgorithmCursorSize &&
+                  sizeof(BlakeState) <= AlgorithmCursorSize && sizeof(GanzState) <= AlgorithmCursorSize,
+                  "algorithm state does not fit the look-ahead cursor");
+    static_assert(offsetof(MarkovState, matrix) <= AlgorithmCursorSize, "markov history does not fit the look-ahead cursor");
+
     AlgorithmState _algoState;
     TuringRegister _turingSR;  // live Turing register (persists across steps -> drift)
 
+    // Look-ahead ring (see resolveStep/prefetchStep)
+    LookAheadEntry _lookAhead[LookAheadSize];
+    GenerationInputs _lookAheadInputs;  // inputs the ring was generated with
+    int _lookAheadLastStep = -1;    // last step handed to tick(), -1 = none since reset
+
     // Output state
     bool _activity = false;
     bool _gateOutput = false;
@@ -335,3 +447,5 @@ private:
     int _currentMaskArrayIndex = 0;  // Current index in the mask array
     int _cachedMaskProgression = -1; // Cached value for progression changes
 };
+
+static_assert(sizeof(TuesdayTrackEngine) <= 944, "TuesdayTrackEngine too large (TeletypeTrackEngine at 944 is the container limit)");
@@ -1,5 +1,7 @@
 #include "EuclideanGenerator.h"
 
+#include <algorithm>
+
 EuclideanGenerator::EuclideanGenerator(SequenceBuilder &builder, Params& params) :
     Generator(builder),
     _params(params)
@@ -46,7 +48,10 @@ void EuclideanGenerator::update()  {
 
     _builder.setLength(_params.steps);
 
-    for (size_t i = 0; i < size_t(_builder.capacity()); ++i) {
-        _builder.setValue(i, _pattern[i % _pattern.size()] ? 1.f : 0.f);
+    GeneratorPattern values;
+    int count = std::min(_builder.capacity(), int(values.size()));
+    for (int i = 0; i < count; ++i) {
+        values[i] = _pattern[i % _pattern.size()] ? 255 : 0;
     }
+    writeValues(values, count);
 }
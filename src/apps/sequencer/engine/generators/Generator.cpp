@@ -8,6 +8,8 @@
 
 #include "core/utils/Container.h"
 
+#include <algorithm>
+
 static Container<EuclideanGenerator, RandomGenerator, AlgoGenerator, HelicalGenerator> generatorContainer;
 static EuclideanGenerator::Params euclideanParams;
 static RandomGenerator::Params randomParams;
@@ -22,6 +24,21 @@ static void initSteps(SequenceBuilder &builder) {
     builder.clearSteps();
 }
 
+void Generator::writeValues(const GeneratorPattern &values, int count) {
+    count = std::min(count, int(values.size()));
+    bool full = _writtenCount != count || _writtenRevision != _builder.editRevision();
+
+    for (int i = 0; i < count; ++i) {
+        if (full || values[i] != _written[i]) {
+            _builder.setValue(i, values[i] * (1.f / 255.f));
+            _written[i] = values[i];
+        }
+    }
+
+    _writtenCount = count;
+    _writtenRevision = _builder.editRevision();
+}
+
 Generator *Generator::execute(Generator::Mode mode, SequenceBuilder &builder) {
     switch (mode) {
     case Mode::InitLayer:
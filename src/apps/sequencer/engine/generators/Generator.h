@@ -85,5 +85,16 @@ public:
     static Generator *execute(Generator::Mode mode, SequenceBuilder &builder);
 
 protected:
+    // Writes values[i] / 255 to the first count steps. Steps still holding the
+    // value of the previous call are skipped unless the edit sequence was
+    // replaced in between, so small parameter changes only touch the steps
+    // they affect.
+    void writeValues(const GeneratorPattern &values, int count);
+
     SequenceBuilder &_builder;
+
+private:
+    GeneratorPattern _written;
+    int _writtenCount = -1;
+    uint32_t _writtenRevision = 0;
 };
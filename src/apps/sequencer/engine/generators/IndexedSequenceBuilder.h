@@ -29,7 +29,8 @@ public:
         _layer(layer),
         _scale(scale),
         _rootNote(rootNote),
-        _showingPreview(false)
+        _showingPreview(false),
+        _previewInEdit(false)
     {}
 
     ~IndexedSequenceBuilder() override {
@@ -41,19 +42,31 @@ public:
         delete _preview;
         _preview = nullptr;
         _showingPreview = false;
+        _previewInEdit = false;
+        touchEdit();
     }
 
     void apply() override {
-        if (_preview) {
+        if (_previewInEdit) {
+            _original = _edit;
+            _showingPreview = true;
+        } else if (_preview) {
             _edit = *_preview;
             _original = *_preview;
+            _previewInEdit = true;
             _showingPreview = true;
+            touchEdit();
         }
     }
 
     void showOriginal() override {
+        if (_previewInEdit) {
+            *_preview = _edit;
+            _previewInEdit = false;
+        }
         _edit = _original;
         _showingPreview = false;
+        touchEdit();
     }
 
     void showPreview() override {
@@ -63,9 +76,13 @@ public:
                 _showingPreview = false;
                 return;
             }
-            *_preview = _edit;
+            _previewInEdit = true;
+        }
+        if (!_previewInEdit) {
+            _edit = *_preview;
+            _previewInEdit = true;
+            touchEdit();
         }
-        _edit = *_preview;
         _showingPreview = true;
     }
 
@@ -76,7 +93,7 @@ public:
                 return;
             }
         }
-        *_preview = _edit;
+        _previewInEdit = true;
     }
 
     bool showingPreview() const override {
@@ -115,16 +132,19 @@ public:
         for (int i = 0; i < IndexedSequence::MaxSteps; ++i) {
             _edit.step(i).clear();
         }
+        touchEdit();
     }
 
     void copyStep(int fromIndex, int toIndex) override {
         _edit.step(toIndex) = _original.step(fromIndex);
+        touchEdit();
     }
 
     void clearLayer() override {
         for (int i = 0; i < IndexedSequence::MaxSteps; ++i) {
             setLayerDefault(_edit.step(i));
         }
+        touchEdit();
     }
 
     // whole-step writers (helical generator) + resolved musical context
@@ -168,4 +188,5 @@ private:
     RotatedScaleView _scale;
     int _rootNote;
     bool _showingPreview;
+    bool _previewInEdit;    // edit sequence holds the latest preview, _preview may be stale
 };
@@ -67,18 +67,23 @@ void RandomGenerator::randomizeContextParams() {
 }
 
 void RandomGenerator::update() {
-    Random rng(_params.seed);
+    int size = _base.size();
 
-    int size = _pattern.size();
+    if (_baseSmooth != _params.smooth || _baseSeed != _params.seed) {
+        Random rng(_params.seed);
 
-    for (int i = 0; i < size; ++i) {
-        _pattern[i] = rng.nextRange(255);
-    }
-
-    for (int iteration = 0; iteration < _params.smooth; ++iteration) {
         for (int i = 0; i < size; ++i) {
-            _pattern[i] = (4 * _pattern[i] + _pattern[(i - 1 + size) % size] + _pattern[(i + 1) % size] + 3) / 6;
+            _base[i] = rng.nextRange(255);
         }
+
+        for (int iteration = 0; iteration < _params.smooth; ++iteration) {
+            for (int i = 0; i < size; ++i) {
+                _base[i] = (4 * _base[i] + _base[(i - 1 + size) % size] + _base[(i + 1) % size] + 3) / 6;
+            }
+        }
+
+        _baseSeed = _params.seed;
+        _baseSmooth = _params.smooth;
     }
 
     int bias = (_params.bias * 255) / 10;
@@ -86,7 +91,7 @@ void RandomGenerator::update() {
     int variation = _params.variation;
 
     for (int i = 0; i < size; ++i) {
-        int value = _pattern[i];
+        int value = _base[i];
         value = ((value + bias - 127) * scale) / 10 + 127;
 
         // Apply variation blend: variation=100 means full generated value,
@@ -100,10 +105,7 @@ void RandomGenerator::update() {
         _pattern[i] = clamp(value, 0, 255);
     }
 
-    int writeCount = clamp(_builder.capacity(), 0, int(_pattern.size()));
-    for (int i = 0; i < writeCount; ++i) {
-        _builder.setValue(i, _pattern[i] * (1.f / 255.f));
-    }
+    writeValues(_pattern, clamp(_builder.capacity(), 0, int(_pattern.size())));
 }
 
 int RandomGenerator::displayValue(int index) const {
@@ -73,4 +73,9 @@ public:
 private:
     Params &_params;
     GeneratorPattern _pattern;
+
+    // smoothed random values, only recomputed when seed or smooth change
+    GeneratorPattern _base;
+    uint32_t _baseSeed = 0;
+    int _baseSmooth = -1;
 };
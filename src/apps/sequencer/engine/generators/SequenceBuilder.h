@@ -34,6 +34,17 @@ public:
     virtual void copyStep(int fromIndex, int toIndex) = 0;
 
     virtual void clearLayer() = 0;
+
+    // Changes whenever the edit sequence is modified other than through
+    // setValue() (revert, original/preview switch, clear, copy). Generators
+    // compare it to tell if the edit sequence still holds their last output.
+    uint32_t editRevision() const { return _editRevision; }
+
+protected:
+    void touchEdit() { ++_editRevision; }
+
+private:
+    uint32_t _editRevision = 0;
 };
 
 template<typename T>
@@ -46,31 +57,48 @@ public:
         _layer(layer),
         _range(T::layerRange(layer)),
         _default(T::layerDefaultValue(layer)),
-        _showingPreview(false)
+        _showingPreview(false),
+        _previewInEdit(false)
     {}
 
     ~SequenceBuilderImpl() override {
         delete _preview;
     }
 
+    // The preview is generated in place in the edit sequence and only stored
+    // to _preview when the original is swapped in, so preview updates and
+    // apply() cost at most a single sequence copy.
+
     void revert() override {
         _edit = _original;
         delete _preview;
         _preview = nullptr;
         _showingPreview = false;
+        _previewInEdit = false;
+        touchEdit();
     }
 
     void apply() override {
-        if (_preview) {
+        if (_previewInEdit) {
+            _original = _edit;
+            _showingPreview = true;
+        } else if (_preview) {
             _edit = *_preview;
             _original = *_preview;
+            _previewInEdit = true;
             _showingPreview = true;
+            touchEdit();
         }
     }
 
     void showOriginal() override {
+        if (_previewInEdit) {
+            *_preview = _edit;
+            _previewInEdit = false;
+        }
         _edit = _original;
         _showingPreview = false;
+        touchEdit();
     }
 
     void showPreview() override {
@@ -80,9 +108,13 @@ public:
                 _showingPreview = false;
                 return;
             }
-            *_preview = _edit;
+            _previewInEdit = true;
+        }
+        if (!_previewInEdit) {
+            _edit = *_preview;
+            _previewInEdit = true;
+            touchEdit();
         }
-        _edit = *_preview;
         _showingPreview = true;
     }
 
@@ -93,7 +125,7 @@ public:
                 return;
             }
         }
-        *_preview = _edit;
+        _previewInEdit = true;
     }
 
     bool showingPreview() const override {
@@ -114,6 +146,10 @@ public:
     }
 
     void setLength(int length) override {
+        if (_edit.firstStep() != 0) {
+            // step indices shift
+            touchEdit();
+        }
         _edit.setFirstStep(0);
         _edit.setLastStep(length - 1);
     }
@@ -134,16 +170,19 @@ public:
 
     void clearSteps() override {
         _edit.clearSteps();
+        touchEdit();
     }
 
     void copyStep(int fromIndex, int toIndex) override {
         _edit.step(_edit.firstStep() + toIndex) = _original.step(_original.firstStep() + fromIndex);
+        touchEdit();
     }
 
     void clearLayer() override {
         for (auto &step : _edit.steps()) {
             step.setLayerValue(_layer, _default);
         }
+        touchEdit();
     }
 
 public:
@@ -158,6 +197,7 @@ private:
     Types::LayerRange _range;
     int _default;
     bool _showingPreview;
+    bool _previewInEdit;    // edit sequence holds the latest preview, _preview may be stale
 };
 
 using NoteSequenceBuilder = SequenceBuilderImpl<NoteSequence>;
@@ -4,6 +4,7 @@ void Calibration::CvOutput::clear() {
     for (size_t i = 0; i < _items.size(); ++i) {
         _items[i] = defaultItemValue(i);
     }
+    ++_revision;
 }
 
 void Calibration::CvOutput::write(VersionedSerializedWriter &writer) const {
@@ -16,6 +17,7 @@ void Calibration::CvOutput::read(VersionedSerializedReader &reader) {
     for (size_t i = 0; i < _items.size(); ++i) {
         reader.read(_items[i]);
     }
+    ++_revision;
 }
 
 void Calibration::CvOutput::update() {
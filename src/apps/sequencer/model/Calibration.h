@@ -43,6 +43,7 @@ public:
 
         void setItem(int index, int value, bool doUpdate = true) {
             _items[index] = (_items[index] & 0x8000) | clamp(value, 0, 0x7fff);
+            ++_revision;
             if (doUpdate) {
                 update();
             }
@@ -83,6 +84,9 @@ public:
             return clamp(int((volts - volts0) / (volts1 - volts0) * 32768), 0, 0x7fff);
         }
 
+        // incremented whenever the items change (see CvCalibrationLut)
+        uint32_t revision() const { return _revision; }
+
         uint16_t voltsToValue(float volts) const {
             volts = clamp(volts, float(MinVoltage), float(MaxVoltage));
             float fIndex = (volts - MinVoltage) * ItemsPerVolt;
@@ -104,6 +108,7 @@ public:
         void update();
 
         ItemArray _items;
+        uint32_t _revision = 0;
     };
 
     using CvOutputArray = std::array<CvOutput, CONFIG_CV_OUTPUT_CHANNELS>;
@@ -267,11 +267,12 @@ void ClipBoard::pasteFractalSequence(FractalSequence &sequence) const {
 
 void ClipBoard::pastePattern(int patternIndex) const {
     if (canPastePattern()) {
-        Model::WriteLock lock;
         const auto &pattern = _container.as<Pattern>();
         for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
             auto &track = _project.track(trackIndex);
             if (track.trackMode() == pattern.sequences[trackIndex].trackMode) {
+                // lock per track, not across all of them
+                Model::WriteLock lock;
                 switch (track.trackMode()) {
                 case Track::TrackMode::Note:
                     track.noteTrack().sequence(patternIndex) = pattern.sequences[trackIndex].data.note;
@@ -283,11 +283,13 @@ public:
     }
 
     // Voltage Range (ABOVE/BELOW)
+    float rawRangeHigh() const { return _rangeHigh; }
     float rangeHigh() const { return Routing::routedValue(ParamKey::DiscreteMapRangeHigh, _trackIndex, _rangeHigh, -5.f, 5.f); }
     void setRangeHigh(float v) {
         _rangeHigh = clamp(v, -5.0f, 5.0f);
     }
 
+    float rawRangeLow() const { return _rangeLow; }
     float rangeLow() const { return Routing::routedValue(ParamKey::DiscreteMapRangeLow, _trackIndex, _rangeLow, -5.f, 5.f); }
     void setRangeLow(float v) {
         _rangeLow = clamp(v, -5.0f, 5.0f);
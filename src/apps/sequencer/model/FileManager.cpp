@@ -229,42 +229,91 @@ int tt2FileRead(void *ctx) {
     return static_cast<fs::FileReader *>(ctx)->read(&ch, 1) == fs::OK
         ? int(static_cast<unsigned char>(ch)) : -1;
 }
+bool tt2FileReadBlock(void *ctx, void *data, size_t len) {
+    return static_cast<fs::FileReader *>(ctx)->read(data, len) == fs::OK;
 }
 
-fs::Error FileManager::writeTt2Program(const TT2Track &track, const char *name, int slot) {
-    return writeFile(FileType::TeletypeV2Program, slot, [&] (const char *path) {
-        return writeTt2Program(track, name, path);
-    });
+// Mini staging overlays the Full CCMRAM scratch — Mini is smaller, and never
+// live at the same time as a Full load.
+static_assert(sizeof(TeletypeProgramT<TT2ConfigMini>) <= sizeof(gTeletypeLoadScratch),
+              "Mini program must fit the Full CCMRAM scratch");
+TeletypeProgramT<TT2ConfigMini> &miniLoadScratch() {
+    return *reinterpret_cast<TeletypeProgramT<TT2ConfigMini> *>(&gTeletypeLoadScratch);
 }
 
-fs::Error FileManager::readTt2Program(TT2Track &track, int slot) {
-    return readFile(FileType::TeletypeV2Program, slot, [&] (const char *path) {
-        return readTt2Program(track, path);
-    });
+// Precompiled scene image lives next to the scene text (TT2/001.TXT -> TT2/001.BIN).
+void tt2ImagePath(StringBuilder &str, const char *path) {
+    const char *dot = std::strrchr(path, '.');
+    int len = dot ? int(dot - path) : int(std::strlen(path));
+    str("%.*s.BIN", len, path);
 }
 
-fs::Error FileManager::writeTt2Program(const TT2Track &track, const char *name, const char *path) {
-    fs::FileWriter fileWriter(path);
+fs::Error hashTt2Text(const char *path, uint32_t &hash) {
+    fs::File file(path, fs::File::Read);
+    if (file.error() != fs::OK) {
+        return file.error();
+    }
+    // hash a sector per read
+    uint8_t buffer[512];
+    size_t length;
+    hash = Tt2TextHashSeed;
+    while (file.read(buffer, sizeof(buffer), &length) == fs::OK && length > 0) {
+        hash = tt2TextHash(hash, buffer, length);
+    }
+    fs::Error error = file.error();
+    fs::Error closeError = file.close();
+    return error != fs::OK ? error : closeError;
+}
+
+template<typename Cfg>
+bool readTt2Image(const char *path, uint32_t textHash, TeletypeProgramT<Cfg> &staging) {
+    FixedStringBuilder<32> imagePath;
+    tt2ImagePath(imagePath, path);
+    if (!fs::exists(imagePath)) {
+        return false;
+    }
+    fs::FileReader fileReader(imagePath);
+    if (fileReader.error() != fs::OK) {
+        return false;
+    }
+    return tt2ReadSceneImage(staging, textHash, tt2FileReadBlock, &fileReader);
+}
+
+template<typename Cfg>
+void writeTt2Image(const char *path, uint32_t textHash, const TeletypeProgramT<Cfg> &program) {
+    FixedStringBuilder<32> imagePath;
+    tt2ImagePath(imagePath, path);
+    fs::FileWriter fileWriter(imagePath);
     if (fileWriter.error() != fs::OK) {
-        return fileWriter.error();
+        return;
+    }
+    tt2WriteSceneImage(program, textHash, tt2FileWrite, &fileWriter);
+    if (fileWriter.finish() != fs::OK) {
+        fs::remove(imagePath);
     }
-    // Leading NAME line for the slot browser; the deserializer ignores any
-    // leading non-#-section lines.
-    const char *safeName = (name && name[0]) ? name : "TT2";
-    FixedStringBuilder<64> nameLine("NAME %s\n", safeName);
-    fileWriter.write(static_cast<const char *>(nameLine), std::strlen(nameLine));
-    tt2SerializeScene(track.program(), tt2FileWrite, &fileWriter);
-    return fileWriter.finish();
 }
 
-fs::Error FileManager::readTt2Program(TT2Track &track, const char *path) {
+// Load a scene into `staging`: straight from the precompiled image when it was
+// lowered from this exact text, otherwise by parsing the text, which refreshes
+// the image for the next load. The image is only a cache, failing to write it
+// is not an error.
+template<typename Cfg>
+fs::Error readTt2Scene(const char *path, TeletypeProgramT<Cfg> &staging) {
+    uint32_t textHash;
+    fs::Error error = hashTt2Text(path, textHash);
+    if (error != fs::OK) {
+        return error;
+    }
+    if (readTt2Image(path, textHash, staging)) {
+        return fs::OK;
+    }
+
     fs::FileReader fileReader(path);
     if (fileReader.error() != fs::OK) {
         return fileReader.error();
     }
-    TeletypeProgram &staging = gTeletypeLoadScratch;
-    bool ok = tt2DeserializeScene(staging, tt2FileRead, &fileReader);
-    fs::Error error = fileReader.finish();
+    bool ok = tt2DeserializeScene<Cfg>(staging, tt2FileRead, &fileReader);
+    error = fileReader.finish();
     // The streaming read intentionally drains to EOF; clean EOF is success, not
     // a failure. Preserve any real I/O error (and parse failure) instead.
     if (error == fs::END_OF_FILE) {
@@ -273,6 +322,68 @@ fs::Error FileManager::readTt2Program(TT2Track &track, const char *path) {
     if (error == fs::OK && !ok) {
         error = fs::INVALID_DATA;
     }
+    if (error == fs::OK) {
+        writeTt2Image(path, textHash, staging);
+    }
+    return error;
+}
+
+struct Tt2HashingWriter {
+    fs::FileWriter &fileWriter;
+    uint32_t hash;
+};
+
+void tt2HashingWrite(void *ctx, const char *data, size_t len) {
+    auto &writer = *static_cast<Tt2HashingWriter *>(ctx);
+    writer.fileWriter.write(data, len);
+    writer.hash = tt2TextHash(writer.hash, data, len);
+}
+
+// Save a scene as text and refresh its image from the program being saved.
+// The text is hashed while it is written and the image holds what the text
+// carries (built in `staging`), so the next load hits the image without
+// parsing the text back here.
+template<typename Cfg>
+fs::Error writeTt2Scene(const char *path, const char *name, const TeletypeProgramT<Cfg> &program, TeletypeProgramT<Cfg> &staging) {
+    fs::FileWriter fileWriter(path);
+    if (fileWriter.error() != fs::OK) {
+        return fileWriter.error();
+    }
+    Tt2HashingWriter writer { fileWriter, Tt2TextHashSeed };
+    // Leading NAME line for the slot browser; the deserializer ignores any
+    // leading non-#-section lines.
+    const char *safeName = (name && name[0]) ? name : "TT2";
+    FixedStringBuilder<64> nameLine("NAME %s\n", safeName);
+    tt2HashingWrite(&writer, nameLine, std::strlen(nameLine));
+    tt2SerializeScene<Cfg>(program, tt2HashingWrite, &writer);
+    fs::Error error = fileWriter.finish();
+    if (error == fs::OK) {
+        tt2SceneContent(program, staging);
+        writeTt2Image(path, writer.hash, staging);
+    }
+    return error;
+}
+}
+
+fs::Error FileManager::writeTt2Program(const TT2Track &track, const char *name, int slot) {
+    return writeFile(FileType::TeletypeV2Program, slot, [&] (const char *path) {
+        return writeTt2Program(track, name, path);
+    });
+}
+
+fs::Error FileManager::readTt2Program(TT2Track &track, int slot) {
+    return readFile(FileType::TeletypeV2Program, slot, [&] (const char *path) {
+        return readTt2Program(track, path);
+    });
+}
+
+fs::Error FileManager::writeTt2Program(const TT2Track &track, const char *name, const char *path) {
+    return writeTt2Scene(path, name, track.program(), gTeletypeLoadScratch);
+}
+
+fs::Error FileManager::readTt2Program(TT2Track &track, const char *path) {
+    TeletypeProgram &staging = gTeletypeLoadScratch;
+    fs::Error error = readTt2Scene(path, staging);
     if (error == fs::OK) {
         track.program() = staging;  // atomic swap on clean parse
     }
@@ -292,35 +403,12 @@ fs::Error FileManager::readTt2MiniScene(TT2MiniTrack &track, int scene, int slot
 }
 
 fs::Error FileManager::writeTt2MiniScene(const TT2MiniTrack &track, int scene, const char *name, const char *path) {
-    fs::FileWriter fileWriter(path);
-    if (fileWriter.error() != fs::OK) {
-        return fileWriter.error();
-    }
-    const char *safeName = (name && name[0]) ? name : "TT2";
-    FixedStringBuilder<64> nameLine("NAME %s\n", safeName);
-    fileWriter.write(static_cast<const char *>(nameLine), std::strlen(nameLine));
-    tt2SerializeScene<TT2ConfigMini>(track.program(scene), tt2FileWrite, &fileWriter);
-    return fileWriter.finish();
+    return writeTt2Scene(path, name, track.program(scene), miniLoadScratch());
 }
 
 fs::Error FileManager::readTt2MiniScene(TT2MiniTrack &track, int scene, const char *path) {
-    fs::FileReader fileReader(path);
-    if (fileReader.error() != fs::OK) {
-        return fileReader.error();
-    }
-    // ponytail: overlay the Mini staging onto the Full CCMRAM scratch — Mini is
-    // smaller (static_assert below), never live at the same time as a Full load.
-    static_assert(sizeof(TeletypeProgramT<TT2ConfigMini>) <= sizeof(gTeletypeLoadScratch),
-                  "Mini program must fit the Full CCMRAM scratch");
-    auto &staging = *reinterpret_cast<TeletypeProgramT<TT2ConfigMini> *>(&gTeletypeLoadScratch);
-    bool ok = tt2DeserializeScene<TT2ConfigMini>(staging, tt2FileRead, &fileReader);
-    fs::Error error = fileReader.finish();
-    if (error == fs::END_OF_FILE) {
-        error = fs::OK;
-    }
-    if (error == fs::OK && !ok) {
-        error = fs::INVALID_DATA;
-    }
+    auto &staging = miniLoadScratch();
+    fs::Error error = readTt2Scene(path, staging);
     if (error == fs::OK) {
         track.program(scene) = staging;  // atomic swap on clean parse
     }
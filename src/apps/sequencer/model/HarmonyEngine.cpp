@@ -44,6 +44,32 @@ const uint8_t HarmonyEngine::ChordIntervalsTable[4][4] = {
     {0, 3, 6, 10}   // HalfDim7: R, ♭3, ♭5, ♭7
 };
 
+// Voice offsets before transpose stay within [-12, 35] (7th + inversion octave
+// + spread octave, or a dropped root), roots in this range never clamp before
+// the transpose step and can use the voicing table.
+static constexpr int TableMinRoot = 12;
+static constexpr int TableMaxRoot = 127 - 35;
+
+const HarmonyEngine::VoicingTable HarmonyEngine::VoicingOffsets = HarmonyEngine::buildVoicingTable();
+
+HarmonyEngine::VoicingTable HarmonyEngine::buildVoicingTable() {
+    const int16_t root = 60;
+    VoicingTable table;
+    for (int quality = 0; quality < 4; ++quality) {
+        for (int inversion = 0; inversion < 4; ++inversion) {
+            for (int voicing = 0; voicing < 4; ++voicing) {
+                auto chord = voiceChord(root, ChordQuality(quality), inversion, Voicing(voicing), 0);
+                auto &offsets = table.offsets[quality][inversion][voicing];
+                offsets[0] = chord.root - root;
+                offsets[1] = chord.third - root;
+                offsets[2] = chord.fifth - root;
+                offsets[3] = chord.seventh - root;
+            }
+        }
+    }
+    return table;
+}
+
 HarmonyEngine::HarmonyEngine()
     : _mode(Ionian)
     , _diatonicMode(true)
@@ -71,13 +97,31 @@ HarmonyEngine::ChordIntervals HarmonyEngine::getChordIntervals(ChordQuality qual
 }
 
 HarmonyEngine::ChordNotes HarmonyEngine::harmonize(int16_t rootNote, uint8_t scaleDegree) const {
+    if (rootNote < TableMinRoot || rootNote > TableMaxRoot) {
+        return harmonizeReference(rootNote, scaleDegree);
+    }
+
+    const auto &offsets = VoicingOffsets.offsets[getDiatonicQuality(scaleDegree)][_inversion][_voicing];
+    int16_t base = rootNote + _transpose;
+
     ChordNotes chord;
+    chord.root = clamp(int16_t(base + offsets[0]), int16_t(0), int16_t(127));
+    chord.third = clamp(int16_t(base + offsets[1]), int16_t(0), int16_t(127));
+    chord.fifth = clamp(int16_t(base + offsets[2]), int16_t(0), int16_t(127));
+    chord.seventh = clamp(int16_t(base + offsets[3]), int16_t(0), int16_t(127));
+    return chord;
+}
 
+HarmonyEngine::ChordNotes HarmonyEngine::harmonizeReference(int16_t rootNote, uint8_t scaleDegree) const {
     // Get chord quality for this scale degree (diatonic mode in Phase 1)
-    ChordQuality quality = getDiatonicQuality(scaleDegree);
+    return voiceChord(rootNote, getDiatonicQuality(scaleDegree), _inversion, _voicing, _transpose);
+}
+
+HarmonyEngine::ChordNotes HarmonyEngine::voiceChord(int16_t rootNote, ChordQuality quality, uint8_t inversion, Voicing voicing, int8_t transpose) {
+    ChordNotes chord;
 
     // Get chord intervals
-    ChordIntervals intervals = getChordIntervals(quality);
+    const uint8_t *intervals = ChordIntervalsTable[quality];
 
     // Apply intervals to root note
     chord.root = applyInterval(rootNote, intervals[0]);
@@ -86,30 +130,30 @@ HarmonyEngine::ChordNotes HarmonyEngine::harmonize(int16_t rootNote, uint8_t sca
     chord.seventh = applyInterval(rootNote, intervals[3]);
 
     // Phase 2: Apply inversion
-    applyInversion(chord);
+    applyInversion(chord, inversion);
 
     // Phase 3: Apply voicing
-    applyVoicing(chord);
+    applyVoicing(chord, voicing);
 
     // Phase 2: Apply transpose
-    applyTranspose(chord);
+    applyTranspose(chord, transpose);
 
     return chord;
 }
 
-int16_t HarmonyEngine::applyInterval(int16_t baseNote, int16_t interval) const {
+int16_t HarmonyEngine::applyInterval(int16_t baseNote, int16_t interval) {
     int16_t result = baseNote + interval;
     return clamp(result, int16_t(0), int16_t(127)); // MIDI range 0-127
 }
 
-void HarmonyEngine::applyInversion(ChordNotes &chord) const {
+void HarmonyEngine::applyInversion(ChordNotes &chord, uint8_t inversion) {
     // Inversion reorders the chord tones by moving notes up an octave
     // Root position (0): R-3-5-7 (no change)
     // 1st inversion (1): 3-5-7-R (root up octave, third becomes bass)
     // 2nd inversion (2): 5-7-R-3 (root and third up octave, fifth becomes bass)
     // 3rd inversion (3): 7-R-3-5 (root, third, fifth up octave, seventh becomes bass)
 
-    switch (_inversion) {
+    switch (inversion) {
         case 0:
             // Root position - no change
             break;
@@ -138,12 +182,12 @@ void HarmonyEngine::applyInversion(ChordNotes &chord) const {
     }
 }
 
-void HarmonyEngine::applyVoicing(ChordNotes &chord) const {
-    if (_voicing == Close) {
+void HarmonyEngine::applyVoicing(ChordNotes &chord, Voicing voicing) {
+    if (voicing == Close) {
         return; // No transformation for close voicing
     }
 
-    switch (_voicing) {
+    switch (voicing) {
         case Drop2: {
             // Drop 2nd highest note down an octave
             // Rank each note by how many others it's higher than (0=lowest, 3=highest)
@@ -185,20 +229,20 @@ void HarmonyEngine::applyVoicing(ChordNotes &chord) const {
     }
 }
 
-void HarmonyEngine::applyTranspose(ChordNotes &chord) const {
+void HarmonyEngine::applyTranspose(ChordNotes &chord, int8_t transpose) {
     // Transpose shifts all chord notes by the same interval
     // Range: -24 to +24 semitones (±2 octaves)
     // applyInterval() handles MIDI range clamping (0-127)
 
-    if (_transpose == 0) {
+    if (transpose == 0) {
         return; // No transpose
     }
 
     // Apply transpose to all chord notes
-    chord.root = applyInterval(chord.root, _transpose);
-    chord.third = applyInterval(chord.third, _transpose);
-    chord.fifth = applyInterval(chord.fifth, _transpose);
-    chord.seventh = applyInterval(chord.seventh, _transpose);
+    chord.root = applyInterval(chord.root, transpose);
+    chord.third = applyInterval(chord.third, transpose);
+    chord.fifth = applyInterval(chord.fifth, transpose);
+    chord.seventh = applyInterval(chord.seventh, transpose);
 }
 
 void HarmonyEngine::write(VersionedSerializedWriter &writer) const {
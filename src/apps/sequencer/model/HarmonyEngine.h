@@ -69,6 +69,11 @@ public:
     ChordIntervals getChordIntervals(ChordQuality quality) const;
     ChordNotes harmonize(int16_t rootNote, uint8_t scaleDegree) const;
 
+    // Step-by-step pipeline (intervals, inversion, voicing, transpose, clamped
+    // after every step). harmonize() reads the precomputed voicing table and
+    // only falls back to this for roots close to the MIDI range limits.
+    ChordNotes harmonizeReference(int16_t rootNote, uint8_t scaleDegree) const;
+
     // Serialization
     void write(VersionedSerializedWriter &writer) const;
     void read(VersionedSerializedReader &reader);
@@ -85,9 +90,19 @@ private:
     static const ChordQuality DiatonicChords[7][7];
     static const uint8_t ChordIntervalsTable[4][4];
 
+    // Voice offsets from the root per [quality][inversion][voicing], without
+    // transpose. Built once from the reference pipeline at startup and shared
+    // by all instances (NoteTrackEngine creates one per harmonized note).
+    struct VoicingTable {
+        int8_t offsets[4][4][4][4];
+    };
+    static const VoicingTable VoicingOffsets;
+    static VoicingTable buildVoicingTable();
+
     // Helper methods
-    int16_t applyInterval(int16_t baseNote, int16_t interval) const;
-    void applyInversion(ChordNotes &chord) const;
-    void applyVoicing(ChordNotes &chord) const;
-    void applyTranspose(ChordNotes &chord) const;
+    static ChordNotes voiceChord(int16_t rootNote, ChordQuality quality, uint8_t inversion, Voicing voicing, int8_t transpose);
+    static int16_t applyInterval(int16_t baseNote, int16_t interval);
+    static void applyInversion(ChordNotes &chord, uint8_t inversion);
+    static void applyVoicing(ChordNotes &chord, Voicing voicing);
+    static void applyTranspose(ChordNotes &chord, int8_t transpose);
 };
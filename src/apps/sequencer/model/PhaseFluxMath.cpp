@@ -1,5 +1,6 @@
 #include "PhaseFluxMath.h"
 
+#include <algorithm>
 #include <cmath>
 
 // 8 traversal patterns. Index 0 is PhaseFlux's original top-down snake
@@ -39,6 +40,90 @@ static const char *kTraversalPatternNames[PhaseFluxMath::kTraversalPatternCount]
     "Snake", "Rows", "SnakeUp", "Cols", "ColSnake", "Spiral", "Inward", "Diag",
 };
 
+// PowerBend lookup tables (see fastPow). Generated, 64 entries each:
+//   kLog2Lut[i]   = log2(1 + i/64)
+//   kRecipLut[i]  = 64 / (64 + i)
+//   kExp2Lut[i]   = 2^(i/64)
+static const float kLog2Lut[64] = {
+    0.000000000f, 0.022367813f, 0.044394119f, 0.066089190f,
+    0.087462841f, 0.108524457f, 0.129283017f, 0.149747120f,
+    0.169925001f, 0.189824559f, 0.209453366f, 0.228818690f,
+    0.247927513f, 0.266786541f, 0.285402219f, 0.303780748f,
+    0.321928095f, 0.339850003f, 0.357552005f, 0.375039431f,
+    0.392317423f, 0.409390936f, 0.426264755f, 0.442943496f,
+    0.459431619f, 0.475733431f, 0.491853096f, 0.507794640f,
+    0.523561956f, 0.539158811f, 0.554588852f, 0.569855608f,
+    0.584962501f, 0.599912842f, 0.614709844f, 0.629356620f,
+    0.643856190f, 0.658211483f, 0.672425342f, 0.686500527f,
+    0.700439718f, 0.714245518f, 0.727920455f, 0.741466986f,
+    0.754887502f, 0.768184325f, 0.781359714f, 0.794415866f,
+    0.807354922f, 0.820178962f, 0.832890014f, 0.845490051f,
+    0.857980995f, 0.870364720f, 0.882643049f, 0.894817763f,
+    0.906890596f, 0.918863237f, 0.930737338f, 0.942514505f,
+    0.954196310f, 0.965784285f, 0.977279923f, 0.988684687f,
+};
+
+static const float kRecipLut[64] = {
+    1.000000000f, 0.984615385f, 0.969696970f, 0.955223881f,
+    0.941176471f, 0.927536232f, 0.914285714f, 0.901408451f,
+    0.888888889f, 0.876712329f, 0.864864865f, 0.853333333f,
+    0.842105263f, 0.831168831f, 0.820512821f, 0.810126582f,
+    0.800000000f, 0.790123457f, 0.780487805f, 0.771084337f,
+    0.761904762f, 0.752941176f, 0.744186047f, 0.735632184f,
+    0.727272727f, 0.719101124f, 0.711111111f, 0.703296703f,
+    0.695652174f, 0.688172043f, 0.680851064f, 0.673684211f,
+    0.666666667f, 0.659793814f, 0.653061224f, 0.646464646f,
+    0.640000000f, 0.633663366f, 0.627450980f, 0.621359223f,
+    0.615384615f, 0.609523810f, 0.603773585f, 0.598130841f,
+    0.592592593f, 0.587155963f, 0.581818182f, 0.576576577f,
+    0.571428571f, 0.566371681f, 0.561403509f, 0.556521739f,
+    0.551724138f, 0.547008547f, 0.542372881f, 0.537815126f,
+    0.533333333f, 0.528925620f, 0.524590164f, 0.520325203f,
+    0.516129032f, 0.512000000f, 0.507936508f, 0.503937008f,
+};
+
+static const float kExp2Lut[64] = {
+    1.000000000f, 1.010889286f, 1.021897149f, 1.033024879f,
+    1.044273782f, 1.055645178f, 1.067140401f, 1.078760798f,
+    1.090507733f, 1.102382583f, 1.114386743f, 1.126521619f,
+    1.138788635f, 1.151189230f, 1.163724859f, 1.176396992f,
+    1.189207115f, 1.202156731f, 1.215247360f, 1.228480536f,
+    1.241857812f, 1.255380757f, 1.269050957f, 1.282870016f,
+    1.296839555f, 1.310961212f, 1.325236643f, 1.339667524f,
+    1.354255547f, 1.369002423f, 1.383909882f, 1.398979673f,
+    1.414213562f, 1.429613338f, 1.445180807f, 1.460917794f,
+    1.476826146f, 1.492907728f, 1.509164428f, 1.525598151f,
+    1.542210825f, 1.559004400f, 1.575980845f, 1.593142151f,
+    1.610490332f, 1.628027422f, 1.645755478f, 1.663676580f,
+    1.681792831f, 1.700106354f, 1.718619298f, 1.737333835f,
+    1.756252160f, 1.775376493f, 1.794709075f, 1.814252176f,
+    1.834008086f, 1.853979125f, 1.874167634f, 1.894575982f,
+    1.915206561f, 1.936061793f, 1.957144124f, 1.978456026f,
+};
+
+// z^e for z in (0, 1), e > 0, as exp2(e * log2(z)). log2 of the mantissa is
+// split into a table entry and a short series on the remainder r < 1/64,
+// exp2 of the fraction into a table entry and a short series on d < 1/64.
+// Relative error stays around 1e-6 over the PowerBend knob range.
+static float fastPow(float z, float e) {
+    int ex;
+    float m = std::frexp(z, &ex) * 2.f;     // m in [1, 2)
+    ex -= 1;
+    int i = std::min(63, int((m - 1.f) * 64.f));
+    float r = m * kRecipLut[i] - 1.f;
+    constexpr float kInvLn2 = 1.442695041f;
+    float log2z = float(ex) + kLog2Lut[i] + r * (1.f - r * (0.5f - r * (1.f / 3.f))) * kInvLn2;
+
+    float y = e * log2z;
+    float fl = std::floor(y);
+    float f = y - fl;
+    int j = std::min(63, int(f * 64.f));
+    constexpr float kLn2 = 0.693147181f;
+    float d = (f - float(j) * (1.f / 64.f)) * kLn2;
+    float frac = kExp2Lut[j] * (1.f + d * (1.f + d * (0.5f + d * (1.f / 6.f))));
+    return std::ldexp(frac, int(fl));
+}
+
 const std::array<uint8_t, PhaseFluxMath::kStageCount> &PhaseFluxMath::traversalOrder(int patternIdx) {
     if (patternIdx < 0) patternIdx = 0;
     if (patternIdx >= kTraversalPatternCount) patternIdx = kTraversalPatternCount - 1;
@@ -56,10 +141,13 @@ const char *PhaseFluxMath::traversalPatternName(int patternIdx) {
 }
 
 float PhaseFluxMath::powerBend(float z, float p) {
-    // Caller guarantees z in [0,1] and p in (-1,+1). Endpoints are exact —
-    // std::pow(0, k) == 0 for k > 0 and std::pow(1, k) == 1 for all k.
+    // Caller guarantees z in [0,1] and p in (-1,+1). Endpoints are exact,
+    // the interior runs on the lookup tables instead of std::pow (per-tick
+    // path for GWarp, pitch warp and response).
+    if (z <= 0.0f) return 0.0f;
+    if (z >= 1.0f) return 1.0f;
     float exponent = (1.0f - p) / (1.0f + p);
-    return std::pow(z, exponent);
+    return fastPow(z, exponent);
 }
 
 float PhaseFluxMath::powerBendKnobToParam(int encoded) {
@@ -232,7 +320,8 @@ bool PhaseFluxMath::deriveTickPosition(
     int cycleTicks,
     int &slotIdx,
     int &activeCell,
-    float &stagePhase) {
+    float &stagePhase,
+    int slotHint) {
 
     if (cycleTicks <= 0) {
         return false;
@@ -241,8 +330,13 @@ bool PhaseFluxMath::deriveTickPosition(
     uint32_t cycleTick = relativeTick % uint32_t(cycleTicks);
 
     // Linear scan suffices for 16 slots — clarity beats a binary search.
+    // Starting at the hint (the previous tick's slot) finds the slot on the
+    // first probe for almost every tick; slots are disjoint so the result
+    // does not depend on the start.
     int slot = 0;
-    for (int i = 0; i < kStageCount; ++i) {
+    int start = (slotHint >= 0 && slotHint < kStageCount) ? slotHint : 0;
+    for (int n = 0; n < kStageCount; ++n) {
+        int i = (start + n) % kStageCount;
         if (int(cycleTick) >= cumulativeTicks[i] && int(cycleTick) < cumulativeTicks[i + 1]) {
             slot = i;
             break;
@@ -109,7 +109,8 @@ public:
 
     /**
      * §3.2 — Derive slot/cell/phase for a relativeTick. Returns false on idle
-     * (cycleTicks == 0); outputs untouched in that case.
+     * (cycleTicks == 0); outputs untouched in that case. slotHint is where the
+     * slot search starts (pass the previous slot), it does not affect results.
      */
     static bool deriveTickPosition(
         const std::array<uint8_t, kStageCount> &traversal,
@@ -118,5 +119,6 @@ public:
         int cycleTicks,
         int &slotIdx,
         int &activeCell,
-        float &stagePhase);
+        float &stagePhase,
+        int slotHint = 0);
 };
@@ -1,4 +1,5 @@
 #include "Project.h"
+#include "Model.h"
 #include "ProjectVersion.h"
 #include "StochasticTypes.h"
 
@@ -423,6 +424,16 @@ void Project::clearPattern(int patternIndex) {
     }
 }
 
+bool Project::duplicatePattern(int patternIndex) {
+    // duplicate track by track in place, only locking out the engine for one sequence at a time
+    bool duplicated = false;
+    for (auto &track : _tracks) {
+        Model::WriteLock lock;
+        duplicated = track.duplicatePattern(patternIndex);
+    }
+    return duplicated;
+}
+
 void Project::setTrackMode(int trackIndex, Track::TrackMode trackMode) {
     // TODO make sure engine is synced to this before updating UI
     _playState.revertSnapshot();
@@ -262,6 +262,8 @@ public:
 
     // midiIntegrationMode
 
+    Types::MidiIntegrationMode midiIntegrationMode() const { return _midiIntegrationMode; }
+
     void editMidiIntegrationMode(int value, bool shift) {
         _midiIntegrationMode = ModelUtils::adjustedEnum(_midiIntegrationMode, value);
     }
@@ -297,7 +299,7 @@ public:
         _midiProgramOffset = midiProgramOffset;
     }
 
-    int midiProgramOffset() {
+    int midiProgramOffset() const {
         return _midiProgramOffset;
     }
 
@@ -586,6 +588,8 @@ public:
 
     void clear();
     void clearPattern(int patternIndex);
+    // copy a pattern to the next pattern slot, returns false if there is none
+    bool duplicatePattern(int patternIndex);
 
     void setTrackMode(int trackIndex, Track::TrackMode trackMode);
 
@@ -19,6 +19,7 @@ public:
     virtual void setValue(int value) = 0;
     virtual std::string getMenuItem() = 0;
     virtual std::string getMenuItemKey() = 0;
+    virtual int getCurrentIndex() = 0;
     virtual void read(VersionedSerializedReader &writer) = 0;
     virtual void write(VersionedSerializedWriter &writer) = 0;
     virtual void reset() = 0;
@@ -84,12 +85,12 @@ public:
         writer.write(getValue());
     };
 
-private:
-    int getCurrentIndex() {
+    int getCurrentIndex() override {
         auto it = std::find(_menuItemValues.begin(), _menuItemValues.end(), _value);
         return std::distance(_menuItemValues.begin(), it);
     }
 
+private:
     T _value;
 
     std::string _key;
@@ -20,11 +20,11 @@ void LedPainter::drawTrackGatesAndSelectedTrack(Leds &leds, const Engine &engine
     bool blink = (os::ticks() % os::time::ms(200)) < os::time::ms(100);
 
     for (int track = 0; track < 8; ++track) {
-        const auto &trackEngine = engine.trackEngine(track);
+        const auto &trackSnapshot = engine.snapshot().track(track);
         const auto &trackState = playState.trackState(track);
 
-        bool activity = trackEngine.activity();
-        bool mute = (trackState.hasMuteRequest() && trackState.mute() != trackState.requestedMute()) ? blink : trackEngine.mute();
+        bool activity = trackSnapshot.activity;
+        bool mute = (trackState.hasMuteRequest() && trackState.mute() != trackState.requestedMute()) ? blink : trackSnapshot.mute;
         bool selected = track == selectedTrack;
 
         if (selected) {
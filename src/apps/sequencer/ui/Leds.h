@@ -41,7 +41,24 @@ public:
 
     const LedArray &array() const { return _array; }
 
+    // Calls setLed(index, red, green) for every LED that changed since the last sync.
+    // Pages repaint the full frame, this hands only the difference to the LED driver.
+    // Returns the number of changed LEDs.
+    template<typename SetLed>
+    int sync(SetLed setLed) {
+        int changed = 0;
+        for (size_t i = 0; i < _array.size(); ++i) {
+            if (_array[i] != _synced[i]) {
+                _synced[i] = _array[i];
+                setLed(int(i), _array[i].first, _array[i].second);
+                ++changed;
+            }
+        }
+        return changed;
+    }
+
 private:
     LedArray _array;
+    LedArray _synced{}; // last frame handed to the LED driver (all off initially, as the driver)
     std::bitset<CONFIG_BLM_ROWS * CONFIG_BLM_COLS_LED> _mask;
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "core/profiler/TaskTelemetry.h"
+
+#include <algorithm>
+
+#include <cstddef>
+#include <cstdint>
+
+// Answers task telemetry queries received as system exclusive messages.
+//
+// Query:   F0 7D 58 01 F7
+// Replies: F0 7D 58 02 <sequence> <task count> <latency> <latency max> <backlog> <backlog max> <skew> <skew max> F7
+//          F0 7D 58 03 <index> <cpu load> <stack size> <stack free> <name> F7 (one per task)
+//
+// Values are 14-bit, LSB first (sequence wraps, others saturate). The cpu load
+// is in 0.1%, stack sizes in bytes, latencies and cv to gate skew in us, the
+// engine tick backlog in clock ticks, names are up to 8 ASCII characters. The
+// reply is sent one message per update to stay within the MIDI message payload
+// pool.
+class TaskTelemetryReporter {
+public:
+    static constexpr uint8_t ManufacturerId = 0x7d; // non-commercial
+    static constexpr uint8_t DeviceId = 0x58;
+    static constexpr size_t MaxNameLength = 8;
+    static constexpr size_t MaxMessageLength = 10 + MaxNameLength;
+
+    enum Command : uint8_t {
+        Query   = 0x01,
+        Header  = 0x02,
+        Task    = 0x03,
+    };
+
+    // handle a received SysEx payload (without F0/F7), returns true if it was a telemetry query
+    bool receive(uint8_t cable, const uint8_t *data, size_t length) {
+        if (length != 3 || data[0] != ManufacturerId || data[1] != DeviceId || data[2] != Query) {
+            return false;
+        }
+        _cable = cable;
+        _pending = true;
+        _index = -1;
+        return true;
+    }
+
+    bool busy() const { return _pending || _index >= 0; }
+
+    // send the next reply message, send(cable, data, length) returns false if the message could not be sent
+    template<typename SendFunc>
+    void update(const TaskTelemetry::Stats &stats, SendFunc send) {
+        if (_pending) {
+            // reply with a consistent snapshot
+            _stats = stats;
+            _pending = false;
+            _index = 0;
+        } else if (_index < 0) {
+            return;
+        }
+
+        uint8_t data[MaxMessageLength];
+        size_t length = _index == 0 ? encodeHeader(data) : encodeTask(data, _index - 1);
+        if (send(_cable, data, length)) {
+            ++_index;
+            if (_index > _stats.taskCount) {
+                _index = -1;
+            }
+        }
+    }
+
+    size_t encodeHeader(uint8_t *data) const {
+        uint8_t *p = data;
+        *p++ = ManufacturerId;
+        *p++ = DeviceId;
+        *p++ = Header;
+        p = encodeValue(p, _stats.sequence & 0x3fff);
+        *p++ = _stats.taskCount;
+        p = encodeValue(p, _stats.releaseLatency);
+        p = encodeValue(p, _stats.releaseLatencyMax);
+        p = encodeValue(p, _stats.tickBacklog);
+        p = encodeValue(p, _stats.tickBacklogMax);
+        p = encodeValue(p, _stats.outputSkew);
+        p = encodeValue(p, _stats.outputSkewMax);
+        return p - data;
+    }
+
+    size_t encodeTask(uint8_t *data, int index) const {
+        const auto &task = _stats.tasks[index];
+        uint8_t *p = data;
+        *p++ = ManufacturerId;
+        *p++ = DeviceId;
+        *p++ = Task;
+        *p++ = index;
+        p = encodeValue(p, task.cpuLoad);
+        p = encodeValue(p, task.stackSize);
+        p = encodeValue(p, task.stackFree);
+        for (size_t i = 0; i < MaxNameLength && task.name && task.name[i]; ++i) {
+            *p++ = task.name[i] & 0x7f;
+        }
+        return p - data;
+    }
+
+private:
+    static uint8_t *encodeValue(uint8_t *p, uint32_t value) {
+        value = std::min(value, uint32_t(0x3fff));
+        *p++ = value & 0x7f;
+        *p++ = (value >> 7) & 0x7f;
+        return p;
+    }
+
+    TaskTelemetry::Stats _stats = {};
+    uint8_t _cable = 0;
+    bool _pending = false;
+    int _index = -1;
+};
@@ -79,18 +79,30 @@ void Ui::update() {
     handleKeys();
     handleEncoder();
     handleMidi();
+    if (_taskTelemetryReporter.busy()) {
+        _taskTelemetryReporter.update(TaskTelemetry::stats(), [this] (uint8_t cable, const uint8_t *data, size_t length) {
+            auto message = MidiMessage::makeSystemExclusive(data, length);
+            return message.hasPayload() && _engine.sendMidi(MidiPort::UsbMidi, cable, message);
+        });
+    }
     auto topPage = _pageManager.top();
     bool mapStepKeys = (topPage != &_pages.teletypeScriptView && topPage != &_pages.teletypePatternView && topPage != &_pages.textInput);
     _keyboardManager.process(_pageKeyState, _globalKeyState, _keyPressEventTracker, _screensaver, _pageManager, mapStepKeys);
 
+    // pages and leds read engine state of the last complete engine frame
+    _engine.acquireSnapshot();
+
     // abort if track engines are not consistent with model
+    // (pages still access the typed track engines for sequence specific state)
     if (!_engine.trackEnginesConsistent()) {
         return;
     }
 
     _leds.clear();
     _pageManager.updateLeds(_leds);
-    _blm.setLeds(_leds.array());
+    _leds.sync([this] (int index, uint8_t red, uint8_t green) {
+        _blm.setLed(index, red, green);
+    });
 
     // update display at target fps
     uint32_t currentTicks = os::ticks();
@@ -102,7 +114,7 @@ void Ui::update() {
             _messageManager.update();
             _messageManager.draw(_canvas);
         } else {
-            _screensaver.on(_engine.gateOutput());
+            _screensaver.on(_engine.snapshot().gateOutput);
         }
         _lcd.draw(_frameBuffer.data());
         _lastFrameBufferUpdateTicks += intervalTicks;
@@ -191,6 +203,13 @@ void Ui::handleEncoder() {
 void Ui::handleMidi() {
     while (_receiveMidiEvents.readable()) {
         auto receiveEvent = _receiveMidiEvents.read();
+        if (receiveEvent.message.isSystemExclusive()) {
+            if (receiveEvent.port == MidiPort::UsbMidi) {
+                const auto &message = receiveEvent.message;
+                _taskTelemetryReporter.receive(receiveEvent.cable, message.payloadData(), message.payloadLength());
+            }
+            continue;
+        }
         if (!_controllerManager.recvMidi(receiveEvent.port, receiveEvent.cable, receiveEvent.message)) {
             // only process events from cable 0
             if (receiveEvent.cable == 0) {
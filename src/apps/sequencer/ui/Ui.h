@@ -9,6 +9,7 @@
 #include "Leds.h"
 #include "ControllerManager.h"
 #include "KeyboardManager.h"
+#include "TaskTelemetryReporter.h"
 
 #include "pages/Pages.h"
 
@@ -77,6 +78,8 @@ private:
     ControllerManager _controllerManager;
     uint32_t _lastControllerUpdateTicks;
 
+    TaskTelemetryReporter _taskTelemetryReporter;
+
     KeyboardManager _keyboardManager;
 
     Screensaver _screensaver;
@@ -751,9 +751,9 @@ void LaunchpadController::navigationButtonDown(Navigation &navigation, const But
 
 void LaunchpadController::drawTracksGateAndSelected(const Engine &engine, int selectedTrack) {
     for (int track = 0; track < 8; ++track) {
-        const auto &trackEngine = engine.trackEngine(track);
-        bool unmutedActivity = trackEngine.activity() && !trackEngine.mute();
-        bool mutedActivity = trackEngine.activity() && trackEngine.mute();
+        const auto &trackSnapshot = engine.snapshot().track(track);
+        bool unmutedActivity = trackSnapshot.activity && !trackSnapshot.mute;
+        bool mutedActivity = trackSnapshot.activity && trackSnapshot.mute;
         bool selected = track == selectedTrack;
         setSceneLed(
             track,
@@ -767,12 +767,12 @@ void LaunchpadController::drawTracksGateAndSelected(const Engine &engine, int se
 
 void LaunchpadController::drawTracksGateAndMute(const Engine &engine, const PlayState &playState) {
     for (int track = 0; track < 8; ++track) {
-        const auto &trackEngine = engine.trackEngine(track);
+        const auto &trackSnapshot = engine.snapshot().track(track);
         setSceneLed(
             track,
             color(
-                trackEngine.mute(),
-                trackEngine.activity()
+                trackSnapshot.mute,
+                trackSnapshot.activity
             )
         );
     }
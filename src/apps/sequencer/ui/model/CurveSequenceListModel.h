@@ -79,6 +79,41 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case FirstStep:
+            revision = revisionOf(_sequence->firstStep(), _sequence->isRouted(Routing::Target::FirstStep));
+            break;
+        case LastStep:
+            revision = revisionOf(_sequence->lastStep(), _sequence->isRouted(Routing::Target::LastStep));
+            break;
+        case RunMode:
+            revision = revisionOf(int(_sequence->runMode()), _sequence->isRouted(Routing::Target::RunMode));
+            break;
+        case Divisor:
+            revision = revisionOf(_sequence->divisor(), _sequence->isRouted(Routing::Target::Divisor));
+            break;
+        case ClockMult:
+            revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult));
+            break;
+        case ResetMeasure:
+            revision = revisionOf(_sequence->resetMeasure());
+            break;
+        case Range:
+            revision = revisionOf(int(_sequence->range()));
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     static const char *itemName(Item item) {
         switch (item) {
@@ -53,6 +53,50 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case PlayMode:
+            revision = revisionOf(int(_track->playMode()));
+            break;
+        case FillMode:
+            revision = revisionOf(int(_track->fillMode()));
+            break;
+        case MuteMode:
+            revision = revisionOf(int(_track->muteMode()));
+            break;
+        case SlideTime:
+            revision = revisionOf(_track->slideTime(), _track->isRouted(Routing::Target::SlideTime));
+            break;
+        case Offset:
+            revision = revisionOf(_track->offset(), _track->isRouted(Routing::Target::Offset));
+            break;
+        case Rotate:
+            revision = revisionOf(_track->rotate(), _track->isRouted(Routing::Target::Rotate));
+            break;
+        case ShapeProbabilityBias:
+            revision = revisionOf(_track->shapeProbabilityBias(), _track->isRouted(Routing::Target::ShapeProbabilityBias));
+            break;
+        case GateProbabilityBias:
+            revision = revisionOf(_track->gateProbabilityBias(), _track->isRouted(Routing::Target::GateProbabilityBias));
+            break;
+        case CurveRate:
+            revision = revisionOf(_track->curveRate(), _track->isRouted(Routing::Target::CurveRate));
+            break;
+        case GlobalPhase:
+            revision = revisionOf(_track->globalPhase(), _track->isRouted(Routing::Target::Phase));
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         PlayMode,
@@ -84,6 +84,74 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case ClockSource:
+            revision = revisionOf(int(_sequence->clockSource()));
+            break;
+        case SyncMode:
+            revision = revisionOf(int(_sequence->syncMode()));
+            break;
+        case Divisor:
+            revision = revisionOf(_sequence->divisor());
+            break;
+        case ClockMult:
+            revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult));
+            break;
+        case GateLength:
+            revision = revisionOf(_sequence->gateLength());
+            break;
+        case Loop:
+            revision = revisionOf(_sequence->loop());
+            break;
+        case ResetMeasure:
+            revision = revisionOf(_sequence->resetMeasure());
+            break;
+        case ThresholdMode:
+            revision = revisionOf(int(_sequence->thresholdMode()));
+            break;
+        case RangeHigh:
+            revision = revisionOf(_sequence->rawRangeHigh());
+            break;
+        case RangeLow:
+            revision = revisionOf(_sequence->rawRangeLow());
+            break;
+        case Scale:
+            revision = revisionOf(_sequence->scale());
+            break;
+        case RootNote:
+            revision = revisionOf(_sequence->rootNote());
+            break;
+        case ScaleRotate:
+            revision = revisionOf(_sequence->scaleRotate());
+            break;
+        case SlewTime:
+            revision = revisionOf(_sequence->slewTime());
+            break;
+        case Pluck:
+            revision = revisionOf(_sequence->pluck());
+            break;
+        case Octave:
+            revision = revisionOf(_sequence->octave());
+            break;
+        case Transpose:
+            revision = revisionOf(_sequence->transpose());
+            break;
+        case Offset:
+            revision = revisionOf(_sequence->offset());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     static const char *itemName(Item item) {
         switch (item) {
@@ -39,6 +39,26 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case PlayMode:
+            revision = revisionOf(int(_track->playMode()));
+            break;
+        case CvUpdateMode:
+            revision = revisionOf(int(_track->cvUpdateMode()));
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         PlayMode,
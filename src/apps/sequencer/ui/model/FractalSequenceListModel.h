@@ -103,6 +103,41 @@ public:
         return int(item);
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case LoopFirst:         revision = revisionOf(_sequence->loopFirst()); break;
+        case LoopLast:          revision = revisionOf(_sequence->loopLast()); break;
+        case OrderMode:         revision = revisionOf(int(_sequence->orderMode())); break;
+        case BranchCount:       revision = revisionOf(_sequence->branchCount()); break;
+        case Path:              revision = revisionOf(_sequence->path()); break;
+        case Divisor:           revision = revisionOf(_sequence->divisor()); break;
+        case ClockMultiplier:   revision = revisionOf(_sequence->clockMultiplier()); break;
+        case ResetMeasure:      revision = revisionOf(_sequence->resetMeasure()); break;
+        case RecordFirst:       revision = revisionOf(_sequence->recordFirst()); break;
+        case RecordLast:        revision = revisionOf(_sequence->recordLast()); break;
+        case RecordMode:        revision = revisionOf(int(_sequence->recordMode())); break;
+        case RecordSkip:        revision = revisionOf(_sequence->recordSkip()); break;
+        case RecordTrigger:     revision = revisionOf(_sequence->recordTrigger()); break;
+        case OrnFirst:          revision = revisionOf(_sequence->ornFirst()); break;
+        case OrnLast:           revision = revisionOf(_sequence->ornLast()); break;
+        case OrnamentRate:      revision = revisionOf(_sequence->ornamentRate()); break;
+        case OrnamentIntensity: revision = revisionOf(_sequence->ornamentIntensity()); break;
+        case CaptureCadence:    revision = revisionOf(int(_sequence->captureCadence())); break;
+        case CaptureFidelity:   revision = revisionOf(int(_sequence->captureFidelity())); break;
+        case Scale:             revision = revisionOf(_sequence->scale(), _sequence->isRouted(Routing::Target::Scale)); break;
+        case RootNote:          revision = revisionOf(_sequence->rootNote(), _sequence->isRouted(Routing::Target::RootNote)); break;
+        case ScaleRotate:       revision = revisionOf(_sequence->scaleRotate()); break;
+        case Last:              return false;
+        }
+        return true;
+    }
+
 private:
     static const char *itemName(Item item) {
         switch (item) {
@@ -45,6 +45,47 @@ public:
         return Routing::Target::None;
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case BufferLength:
+            revision = revisionOf(_track->bufferLength());
+            break;
+        case Octave:
+            revision = revisionOf(_track->octave());
+            break;
+        case Transpose:
+            revision = revisionOf(_track->transpose());
+            break;
+        case SlideTime:
+            revision = revisionOf(_track->slideTime());
+            break;
+        case CvUpdateMode:
+            revision = revisionOf(int(_track->cvUpdateMode()));
+            break;
+        case Quantize:
+            revision = revisionOf(_track->quantize());
+            break;
+        case Delay:
+            revision = revisionOf(_track->trackDelay());
+            break;
+        case Lock:
+            revision = revisionOf(_track->lock());
+            break;
+        case RecordMuted:
+            revision = revisionOf(_track->recordMuted());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         BufferLength,
@@ -91,6 +91,54 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case Divisor:
+            revision = revisionOf(_sequence->divisor());
+            break;
+        case ClockMult:
+            revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult));
+            break;
+        case Length:
+        case Active:
+            revision = revisionOf(_sequence->activeLength());
+            break;
+        case Loop:
+            revision = revisionOf(_sequence->loop());
+            break;
+        case RunMode:
+            revision = revisionOf(int(_sequence->runMode()), _sequence->isRouted(Routing::Target::RunMode));
+            break;
+        case Scale:
+            revision = revisionOf(_sequence->scale());
+            break;
+        case RootNote:
+            revision = revisionOf(_sequence->rootNote(), _sequence->isRouted(Routing::Target::RootNote));
+            break;
+        case ScaleRotate:
+            revision = revisionOf(_sequence->scaleRotate());
+            break;
+        case FirstStep:
+            revision = revisionOf(_sequence->firstStep(), _sequence->isRouted(Routing::Target::FirstStep));
+            break;
+        case SyncMode:
+            revision = revisionOf(int(_sequence->syncMode()));
+            break;
+        case ResetMeasure:
+            revision = revisionOf(_sequence->resetMeasure());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     static const char *itemName(Item item) {
         switch (item) {
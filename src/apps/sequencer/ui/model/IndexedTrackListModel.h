@@ -45,6 +45,35 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case PlayMode:
+            revision = revisionOf(int(_track->playMode()));
+            break;
+        case CvUpdateMode:
+            revision = revisionOf(int(_track->cvUpdateMode()));
+            break;
+        case SlideTime:
+            revision = revisionOf(_track->slideTime(), _track->isRouted(Routing::Target::SlideTime));
+            break;
+        case Octave:
+            revision = revisionOf(_track->octave(), _track->isRouted(Routing::Target::Octave));
+            break;
+        case Transpose:
+            revision = revisionOf(_track->transpose(), _track->isRouted(Routing::Target::Transpose));
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         PlayMode,
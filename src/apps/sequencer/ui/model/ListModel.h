@@ -11,6 +11,11 @@ public:
 
     virtual void cell(int row, int column, StringBuilder &str) const = 0;
 
+    // Revision of a cell's content for ListPage's formatted cell cache: any value
+    // that changes whenever the text of cell() changes (e.g. the raw parameter
+    // value). Return false for cells that have to be formatted on every frame.
+    virtual bool cellRevision(int row, int column, uint64_t &revision) const { return false; }
+
     virtual void edit(int row, int column, int value, bool shift) = 0;
 
     virtual Routing::Target routingTarget(int) const { return Routing::Target::None; }
@@ -45,6 +45,73 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        const auto &arpeggiator = _track->arpeggiator();
+
+        switch (Item(row)) {
+        case Source:
+            revision = revisionOf(int(_track->source().port()) << 8 | (_track->source().channel() & 0xff));
+            break;
+        case Voices:
+            revision = revisionOf(_track->voices());
+            break;
+        case VoiceConfig:
+            revision = revisionOf(int(_track->voiceConfig()));
+            break;
+        case NotePriority:
+            revision = revisionOf(int(_track->notePriority()));
+            break;
+        case LowNote:
+            revision = revisionOf(_track->lowNote());
+            break;
+        case HighNote:
+            revision = revisionOf(_track->highNote());
+            break;
+        case PitchBendRange:
+            revision = revisionOf(_track->pitchBendRange());
+            break;
+        case ModulationRange:
+            revision = revisionOf(int(_track->modulationRange()));
+            break;
+        case Retrigger:
+            revision = revisionOf(_track->retrigger());
+            break;
+        case SlideTime:
+            revision = revisionOf(_track->slideTime(), _track->isRouted(Routing::Target::SlideTime));
+            break;
+        case Transpose:
+            revision = revisionOf(_track->transpose(), _track->isRouted(Routing::Target::Transpose));
+            break;
+        case ArpeggiatorEnabled:
+            revision = revisionOf(arpeggiator.enabled());
+            break;
+        case ArpeggiatorHold:
+            revision = revisionOf(arpeggiator.hold());
+            break;
+        case ArpeggiatorMode:
+            revision = revisionOf(int(arpeggiator.mode()));
+            break;
+        case ArpeggiatorDivisor:
+            revision = revisionOf(arpeggiator.divisor());
+            break;
+        case ArpeggiatorGateLength:
+            revision = revisionOf(arpeggiator.gateLength());
+            break;
+        case ArpeggiatorOctaves:
+            revision = revisionOf(arpeggiator.octaves());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         Source,
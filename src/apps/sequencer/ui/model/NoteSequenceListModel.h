@@ -92,6 +92,69 @@ public:
         }
     }
 
+protected:
+    // Rows map to different items depending on the mode, so both revisions
+    // include the item shown in the row.
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = revisionOf(int(itemForRow(row)) << 8 | int(_sequence->mode()));
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        Item item = itemForRow(row);
+        switch (item) {
+        case Mode:
+            revision = revisionOf(int(_sequence->mode()));
+            break;
+        case FirstStep:
+            revision = revisionOf(_sequence->firstStep(), _sequence->isRouted(Routing::Target::FirstStep));
+            break;
+        case LastStep:
+            revision = revisionOf(_sequence->lastStep(), _sequence->isRouted(Routing::Target::LastStep));
+            break;
+        case NoteFirstStep:
+            revision = revisionOf(_sequence->noteFirstStep());
+            break;
+        case NoteLastStep:
+            revision = revisionOf(_sequence->noteLastStep());
+            break;
+        case RunMode:
+            revision = revisionOf(int(_sequence->runMode()), _sequence->isRouted(Routing::Target::RunMode));
+            break;
+        case DivisorX:
+            revision = revisionOf(_sequence->divisor(), _sequence->isRouted(Routing::Target::Divisor));
+            break;
+        case DivisorY:
+            revision = revisionOf(_sequence->divisorY());
+            break;
+        case DivisorYSource:
+            revision = revisionOf(int(_sequence->divisorYSource()));
+            break;
+        case DivisorYTrack:
+            revision = revisionOf(_sequence->divisorYTrack());
+            break;
+        case ClockMult:
+            revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult));
+            break;
+        case ResetMeasure:
+            revision = revisionOf(_sequence->resetMeasure());
+            break;
+        case Scale:
+            revision = revisionOf(_sequence->scale(), _sequence->isRouted(Routing::Target::Scale));
+            break;
+        case RootNote:
+            revision = revisionOf(_sequence->rootNote(), _sequence->isRouted(Routing::Target::RootNote));
+            break;
+        case ScaleRotate:
+            revision = revisionOf(_sequence->scaleRotate());
+            break;
+        case Last:
+            return false;
+        }
+        revision |= uint64_t(item) << 40;
+        return true;
+    }
+
 private:
     const char *itemName(Item item) const {
         switch (item) {
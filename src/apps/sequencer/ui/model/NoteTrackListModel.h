@@ -57,6 +57,19 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        Routing::Target target = routingTarget(row);
+        bool routed = target != Routing::Target::None && _track->isRouted(target);
+        revision = revisionOf(value(Item(row)), routed);
+        return true;
+    }
+
 private:
     enum Item {
         PlayMode,
@@ -140,6 +153,26 @@ private:
         }
     }
 
+    // raw (routed) value shown by formatValue()
+    int value(Item item) const {
+        switch (item) {
+        case PlayMode:                  return int(_track->playMode());
+        case FillMode:                  return int(_track->fillMode());
+        case FillMuted:                 return int(_track->fillMuted());
+        case CvUpdateMode:              return int(_track->cvUpdateMode());
+        case SlideTime:                 return _track->slideTime();
+        case Octave:                    return _track->octave();
+        case Transpose:                 return _track->transpose();
+        case Rotate:                    return _track->rotate();
+        case GateProbabilityBias:       return _track->gateProbabilityBias();
+        case RetriggerProbabilityBias:  return _track->retriggerProbabilityBias();
+        case LengthBias:                return _track->lengthBias();
+        case NoteProbabilityBias:       return _track->noteProbabilityBias();
+        case Last:                      break;
+        }
+        return 0;
+    }
+
     void editValue(Item item, int value, bool shift) {
         switch (item) {
         case PlayMode:
@@ -32,6 +32,39 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case Divisor:        revision = revisionOf(_sequence->divisor(), _sequence->isRouted(Routing::Target::Divisor)); break;
+        case ClockMult:      revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult)); break;
+        case GlobalPhase:    revision = revisionOf(_sequence->globalPhase(), _sequence->isRouted(Routing::Target::Phase)); break;
+        case PitchMode:      revision = revisionOf(int(_sequence->pitchMode())); break;
+        case PitchRate:      revision = revisionOf(_sequence->pitchRate()); break;
+        case Traversal:      revision = revisionOf(_sequence->traversalPattern()); break;
+        case FirstStage:     revision = revisionOf(_sequence->firstStage()); break;
+        case LastStage:      revision = revisionOf(_sequence->lastStage()); break;
+        case CycleLength:    revision = revisionOf(int(_sequence->cycleLength())); break;
+        case NoteAccumMode:  revision = revisionOf(int(_sequence->noteAccumConfig().scope())); break;
+        case PulseAccumMode: revision = revisionOf(int(_sequence->pulseAccumConfig().scope())); break;
+        case WarpNudge:      revision = revisionOf(_sequence->warpNudge()); break;
+        case ResponseNudge:  revision = revisionOf(_sequence->responseNudge()); break;
+        case PulseNudge:     revision = revisionOf(_sequence->pulseNudge()); break;
+        case LenNudge:       revision = revisionOf(_sequence->lenNudge()); break;
+        case CyclePhaseWarp: revision = revisionOf(_sequence->cyclePhaseWarp()); break;
+        case Scale:          revision = revisionOf(_sequence->scale(), _sequence->isRouted(Routing::Target::Scale)); break;
+        case RootNote:       revision = revisionOf(_sequence->rootNote(), _sequence->isRouted(Routing::Target::RootNote)); break;
+        case ScaleRotate:    revision = revisionOf(_sequence->scaleRotate()); break;
+        case ResetMeasure:   revision = revisionOf(_sequence->resetMeasure()); break;
+        case Last:           return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         Divisor,
@@ -31,6 +31,25 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case PlayMode:     revision = revisionOf(int(_track->playMode())); break;
+        case FillMode:     revision = revisionOf(int(_track->fillMode())); break;
+        case CvUpdateMode: revision = revisionOf(int(_track->cvUpdateMode())); break;
+        case SlideTime:    revision = revisionOf(_track->slideTime()); break;
+        case Octave:       revision = revisionOf(_track->octave()); break;
+        case Transpose:    revision = revisionOf(_track->transpose()); break;
+        case Last:         return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         PlayMode,
@@ -45,6 +45,73 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    // The project name is text and formatted on every frame.
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case Name:
+            return false;
+        case Tempo:
+            revision = revisionOf(_project.tempo(), _project.isRouted(Routing::Target::Tempo));
+            break;
+        case Swing:
+            revision = revisionOf(_project.swing(), _project.isRouted(Routing::Target::Swing));
+            break;
+        case TimeSignature:
+            revision = revisionOf(_project.timeSignature().beats() << 8 | _project.timeSignature().note());
+            break;
+        case SyncMeasure:
+            revision = revisionOf(_project.syncMeasure());
+            break;
+        case AlwaysSync:
+            revision = revisionOf(_project.alwaysSyncPatterns());
+            break;
+        case Scale:
+            revision = revisionOf(_project.scale());
+            break;
+        case RootNote:
+            revision = revisionOf(_project.rootNote());
+            break;
+        case ScaleRotate:
+            revision = revisionOf(_project.scaleRotate());
+            break;
+        case MonitorMode:
+            revision = revisionOf(int(_project.monitorMode()));
+            break;
+        case RecordMode:
+            revision = revisionOf(int(_project.recordMode()));
+            break;
+        case MidiInput: {
+            const auto &source = _project.midiInputSource();
+            revision = revisionOf(int(_project.midiInputMode()) << 16 | int(source.port()) << 8 | (source.channel() & 0xff));
+            break;
+        }
+        case MidiIntegrationMode:
+            revision = revisionOf(int(_project.midiIntegrationMode()));
+            break;
+        case MidiProgramOffset:
+            revision = revisionOf(_project.midiProgramOffset());
+            break;
+        case CvGateInput:
+            revision = revisionOf(int(_project.cvGateInput()));
+            break;
+        case CurveCvInput:
+            revision = revisionOf(int(_project.curveCvInput()));
+            break;
+        case BusSafety:
+            revision = revisionOf(_project.busSafety());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         Name,
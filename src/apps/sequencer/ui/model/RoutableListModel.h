@@ -4,7 +4,38 @@
 
 #include "model/Routing.h"
 
+#include <cstring>
+
 class RoutableListModel : public ListModel {
 public:
     virtual Routing::Target routingTarget(int row) const override = 0;
+
+    virtual bool cellRevision(int row, int column, uint64_t &revision) const override {
+        if (column == 0) {
+            return nameRevision(row, revision);
+        } else if (column == 1) {
+            return valueRevision(row, revision);
+        }
+        return false;
+    }
+
+protected:
+    // Revision of the name cell of a row. Models with a fixed name per row
+    // report revision 0.
+    virtual bool nameRevision(int row, uint64_t &revision) const { return false; }
+
+    // Revision of the value cell of a row. It has to determine the text
+    // completely, including the routed marker in front of the value.
+    virtual bool valueRevision(int row, uint64_t &revision) const { return false; }
+
+    static uint64_t revisionOf(int value, bool routed = false) {
+        return uint64_t(uint32_t(value)) << 1 | (routed ? 1 : 0);
+    }
+
+    // floats are revised by their bits, formatting is deterministic
+    static uint64_t revisionOf(float value, bool routed = false) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return revisionOf(int(bits), routed);
+    }
 };
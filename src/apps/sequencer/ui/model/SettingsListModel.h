@@ -28,6 +28,12 @@ public:
         }
     }
 
+    bool cellRevision(int row, int column, uint64_t &revision) const override {
+        // names are fixed, values only change with the selected menu item
+        revision = column == 1 ? _userSettings.get(row)->getCurrentIndex() : 0;
+        return true;
+    }
+
     void edit(int row, int column, int value, bool shift) override {
         if (column == 1) {
             _userSettings.shift(row, value);
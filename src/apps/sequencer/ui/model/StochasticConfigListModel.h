@@ -116,6 +116,33 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        const auto &sequence = _track->sequence(_project->selectedPatternIndex());
+        switch (Item(row)) {
+        case Lock:          revision = revisionOf(_track->lock()); break;
+        case PlayMode:      revision = revisionOf(int(_track->playMode())); break;
+        case Divisor:       revision = revisionOf(sequence.divisor()); break;
+        case ClockMult:     revision = revisionOf(sequence.clockMultiplier(), sequence.isRouted(Routing::Target::ClockMult)); break;
+        case ResetMeasure:  revision = revisionOf(sequence.resetMeasure()); break;
+        case Scale:         revision = revisionOf(sequence.scale()); break;
+        case RootNote:      revision = revisionOf(sequence.rootNote()); break;
+        case ScaleRotate:   revision = revisionOf(sequence.scaleRotate()); break;
+        case Octave:        revision = revisionOf(_track->octave(), _track->isRouted(Routing::Target::Octave)); break;
+        case Transpose:     revision = revisionOf(_track->transpose(), _track->isRouted(Routing::Target::Transpose)); break;
+        case CvUpdateMode:  revision = revisionOf(int(_track->cvUpdateMode())); break;
+        case SlideTime:     revision = revisionOf(_track->slideTime(), _track->isRouted(Routing::Target::SlideTime)); break;
+        case FillMode:      revision = revisionOf(int(_track->fillMode())); break;
+        case LastItem:      return false;
+        }
+        return true;
+    }
+
 private:
     StochasticTrack *_track = nullptr;
     Project *_project = nullptr;
@@ -103,7 +103,62 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        const auto &sequence = _track->sequence(_project->selectedPatternIndex());
+        revision = itemRevision(itemForRow(row), sequence);
+        return true;
+    }
+
 private:
+    // Note duration and burst labels also depend on the clock divisor.
+    uint64_t itemRevision(Item item, const StochasticSequence &sequence) const {
+        switch (item) {
+        case Mode:          return revisionOf(int(sequence.rhythmMode()) << 8 | int(sequence.melodyMode()));
+        case GateLength:    return revisionOf(sequence.gateLength(), sequence.isRouted(Routing::Target::StochasticGateLength));
+        case Character:     return revisionOf(sequence.complexity(), sequence.isRouted(Routing::Target::StochasticComplexity));
+        case Rhythm:        return revisionOf(int(sequence.rhythmMode()));
+        case Melody:        return revisionOf(int(sequence.melodyMode()));
+        case Complexity:    return revisionOf(sequence.complexity(), sequence.isRouted(Routing::Target::StochasticComplexity));
+        case Contour:       return revisionOf(sequence.contour(), sequence.isRouted(Routing::Target::StochasticContour));
+        case RepeatProb:    return revisionOf(sequence.repeatProb());
+        case Repeat:        return revisionOf(sequence.repeatProb());
+        case Shape:         return revisionOf(int(sequence.marblesMode()));
+        case Spread:        return revisionOf(sequence.marblesSpread());
+        case Bias:          return revisionOf(sequence.marblesBias());
+        case MaskMelody:    return revisionOf(sequence.maskMelody());
+        case TiltMelody:    return revisionOf(sequence.tiltMelody());
+        case NoteDuration:  return revisionOf(sequence.divisor() << 8 | sequence.noteDuration(), sequence.isRouted(Routing::Target::StochasticNoteDuration));
+        case Variation:     return revisionOf(sequence.variation(), sequence.isRouted(Routing::Target::StochasticVariation));
+        case Rest:          return revisionOf(sequence.rest(), sequence.isRouted(Routing::Target::StochasticRest));
+        case SlideProb:     return revisionOf(sequence.slide(), sequence.isRouted(Routing::Target::StochasticSlide));
+        case LegatoProb:    return revisionOf(sequence.legatoProb());
+        case Burst:         return revisionOf(sequence.divisor() << 16 | sequence.noteDuration() << 8 | sequence.burst(), sequence.isRouted(Routing::Target::StochasticBurst));
+        case BurstCount:    return revisionOf(sequence.burstCount());
+        case BurstRate:     return revisionOf(sequence.burstRate());
+        case BurstHold:     return revisionOf(int(sequence.burstHold()));
+        case MaskRhythm:    return revisionOf(sequence.maskRhythm(), sequence.isRouted(Routing::Target::StochasticMask));
+        case TiltRhythm:    return revisionOf(sequence.tiltRhythm(), sequence.isRouted(Routing::Target::StochasticTilt));
+        case Sleep:         return revisionOf(sequence.sleep(), sequence.isRouted(Routing::Target::StochasticSleep));
+        case Patience:      return revisionOf(sequence.patienceRhythm(), sequence.isRouted(Routing::Target::StochasticPatienceRhythm));
+        case PatienceMelody:return revisionOf(sequence.patienceMelody());
+        case Mutate:        return revisionOf(sequence.mutate(), sequence.isRouted(Routing::Target::StochasticMutate));
+        case Jump:          return revisionOf(sequence.jump(), sequence.isRouted(Routing::Target::StochasticJump));
+        case Size:          return revisionOf(sequence.size());
+        case First:         return revisionOf(sequence.first());
+        case Rotate:        return revisionOf(sequence.rotate(), sequence.isRouted(Routing::Target::Rotate));
+        case Range:         return revisionOf(sequence.range());
+        case Refresh:       return 0;
+        case LastItem:      break;
+        }
+        return 0;
+    }
+
     // Phase 11: single flat list. Level enum kept in model for serialization but
     // no longer gates visibility — all sequence-level controls are visible.
     static const Item items[];
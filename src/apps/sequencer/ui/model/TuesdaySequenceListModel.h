@@ -80,6 +80,89 @@ public:
         }
     }
 
+protected:
+    virtual bool nameRevision(int row, uint64_t &revision) const override {
+        revision = 0;
+        return true;
+    }
+
+    virtual bool valueRevision(int row, uint64_t &revision) const override {
+        switch (Item(row)) {
+        case Algorithm:
+            revision = revisionOf(_sequence->algorithm(), _sequence->isRouted(Routing::Target::Algorithm));
+            break;
+        case Flow:
+            revision = revisionOf(_sequence->flow(), _sequence->isRouted(Routing::Target::Flow));
+            break;
+        case Ornament:
+            revision = revisionOf(_sequence->ornament(), _sequence->isRouted(Routing::Target::Ornament));
+            break;
+        case Power:
+            revision = revisionOf(_sequence->power(), _sequence->isRouted(Routing::Target::Power));
+            break;
+        case LoopLength:
+            revision = revisionOf(_sequence->loopLength());
+            break;
+        case Rotate:
+            revision = revisionOf(_sequence->rotate(), _sequence->isRouted(Routing::Target::Rotate));
+            break;
+        case Glide:
+            revision = revisionOf(_sequence->glide(), _sequence->isRouted(Routing::Target::Glide));
+            break;
+        case Skew:
+            revision = revisionOf(_sequence->skew());
+            break;
+        case GateLength:
+            revision = revisionOf(_sequence->gateLength(), _sequence->isRouted(Routing::Target::GateLength));
+            break;
+        case CvUpdateMode:
+            revision = revisionOf(int(_sequence->cvUpdateMode()));
+            break;
+        case Trill:
+            revision = revisionOf(_sequence->trill(), _sequence->isRouted(Routing::Target::Trill));
+            break;
+        case Start:
+            revision = revisionOf(_sequence->start());
+            break;
+        case Octave:
+            revision = revisionOf(_sequence->octave(), _sequence->isRouted(Routing::Target::Octave));
+            break;
+        case Transpose:
+            revision = revisionOf(_sequence->transpose(), _sequence->isRouted(Routing::Target::Transpose));
+            break;
+        case Divisor:
+            revision = revisionOf(_sequence->divisor(), _sequence->isRouted(Routing::Target::Divisor));
+            break;
+        case ClockMult:
+            revision = revisionOf(_sequence->clockMultiplier(), _sequence->isRouted(Routing::Target::ClockMult));
+            break;
+        case ResetMeasure:
+            revision = revisionOf(_sequence->resetMeasure());
+            break;
+        case Scale:
+            revision = revisionOf(_sequence->scale());
+            break;
+        case RootNote:
+            revision = revisionOf(_sequence->rootNote());
+            break;
+        case ScaleRotate:
+            revision = revisionOf(_sequence->scaleRotate());
+            break;
+        case MaskParameter:
+            revision = revisionOf(_sequence->maskParameter());
+            break;
+        case TimeMode:
+            revision = revisionOf(_sequence->timeMode());
+            break;
+        case MaskProgression:
+            revision = revisionOf(_sequence->maskProgression());
+            break;
+        case Last:
+            return false;
+        }
+        return true;
+    }
+
 private:
     enum Item {
         Algorithm,
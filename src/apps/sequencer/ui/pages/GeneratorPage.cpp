@@ -205,6 +205,7 @@ void GeneratorPage::enter() {
     _valueRange.first = 0;
     _valueRange.second = 7;
     _previewArmed = false;
+    _updatePending = false;
     _section = 0;
 
     // Enter in ORIGINAL state — first preview is created only on explicit reroll action
@@ -223,6 +224,8 @@ void GeneratorPage::draw(Canvas &canvas) {
         return;
     }
 
+    flushPendingUpdate();
+
     const char *activeFunction = _generator->name();
     const char *functionNames[5];
     for (int i = 0; i < 5; ++i) {
@@ -345,6 +348,8 @@ void GeneratorPage::updateLeds(Leds &leds) {
         return;
     }
 
+    flushPendingUpdate();
+
     int currentStep;
     switch (_project.selectedTrack().trackMode()) {
     case Track::TrackMode::Note: {
@@ -438,6 +443,7 @@ void GeneratorPage::keyPress(KeyPressEvent &event) {
         if (abPreviewGenerator(_generator->mode())) {
             _previewArmed = true;
         }
+        _updatePending = false;
         if (_generator->mode() == Generator::Mode::Random) {
             static_cast<RandomGenerator *>(_generator)->randomizeContextParams();
             _generator->update();
@@ -470,6 +476,7 @@ void GeneratorPage::keyPress(KeyPressEvent &event) {
         if (abPreviewGenerator(_generator->mode())) {
             _previewArmed = true;
         }
+        _updatePending = false;
         if (_generator->mode() == Generator::Mode::Random) {
             auto *random = static_cast<RandomGenerator *>(_generator);
             random->randomizeParams();
@@ -547,6 +554,8 @@ void GeneratorPage::togglePreview() {
         return;
     }
 
+    flushPendingUpdate();
+
     if (_generator->showingPreview()) {
         _generator->showOriginal();
         showMessage("ORIGINAL");
@@ -601,11 +610,22 @@ void GeneratorPage::encoder(EncoderEvent &event) {
         if (abPreviewGenerator(_generator->mode())) {
             _previewArmed = true;
         }
-        _generator->update();
-        if (abPreviewGenerator(_generator->mode())) {
-            _generator->updatePreview();
-            _generator->showPreview();
-        }
+        // regenerate once per UI update, a burst of encoder steps only
+        // generates the final parameter state
+        _updatePending = true;
+    }
+}
+
+void GeneratorPage::flushPendingUpdate() {
+    if (!_updatePending) {
+        return;
+    }
+    _updatePending = false;
+
+    _generator->update();
+    if (abPreviewGenerator(_generator->mode())) {
+        _generator->updatePreview();
+        _generator->showPreview();
     }
 }
 
@@ -1100,6 +1120,7 @@ void GeneratorPage::init() {
     }
     _generator->init();
     _previewArmed = false;
+    _updatePending = false;
     _generator->showOriginal();
 }
 
@@ -1107,6 +1128,7 @@ void GeneratorPage::revert() {
     if (_stepSelection) {
         _stepSelection->clear();
     }
+    _updatePending = false;
     _generator->revert();
     _applied = false;
     close();
@@ -1117,6 +1139,8 @@ void GeneratorPage::commit() {
         return;
     }
 
+    flushPendingUpdate();
+
     if (abPreviewGenerator(_generator->mode()) && !_previewArmed && !_generator->showingPreview()) {
         // Allow commit even if preview wasn't armed — user made changes
         _applied = true;
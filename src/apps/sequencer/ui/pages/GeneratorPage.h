@@ -65,6 +65,7 @@ private:
     bool ensureBoundTrackContext();
     int currentStep() const;
     bool stepInCurrentBank(int step) const;
+    void flushPendingUpdate();
 
     void drawEuclideanGenerator(Canvas &canvas, const EuclideanGenerator &generator) const;
     void drawValueGenerator(Canvas &canvas, const Generator &generator) const;
@@ -76,6 +77,7 @@ private:
 
     int _section = 0;
     bool _previewArmed = false;
+    bool _updatePending = false;
     bool _applied = false;
     int _boundTrackIndex = -1;
     Track::TrackMode _boundTrackMode = Track::TrackMode::Note;
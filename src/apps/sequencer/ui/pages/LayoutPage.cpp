@@ -73,10 +73,8 @@ void LayoutPage::commitLayout() {
         _manager.pages().confirmation.show("ARE YOU SURE?", [this] (bool result) {
             if (result) {
                 setEdit(false);
-                // we are about to change track engines -> lock the engine to avoid inconsistent state
-                _engine.lock();
-                _trackModeListModel.toProject(_project);
-                _engine.unlock();
+                // we are about to change track engines -> let the engine apply the change to avoid inconsistent state
+                _engine.invoke([this] () { _trackModeListModel.toProject(_project); });
                 showMessage("LAYOUT CHANGED");
             }
         });
@@ -11,6 +11,8 @@
 #include "model/RouteDraft.h"
 #include "model/RouteBrowse.h"
 
+#include <cstring>
+
 namespace {
 
 // Inline modulation edit state. The Draft holds a full Routing::Route (large), so it
@@ -86,6 +88,7 @@ ListPage::ListPage(PageManager &manager, PageContext &context, ListModel &listMo
 
 void ListPage::setListModel(ListModel &listModel) {
     _listModel = &listModel;
+    invalidateCellCache();
     _selectedRow = 0;
     _displayRow = 0;
     _edit = false;
@@ -96,6 +99,7 @@ void ListPage::show() {
 }
 
 void ListPage::enter() {
+    invalidateCellCache();
     scrollTo(_selectedRow);
 }
 
@@ -126,10 +130,10 @@ void ListPage::draw(Canvas &canvas) {
             int ry = 12 + i * LineHeight;
             drawCell(canvas, row, 0, 8, ry, 128 - 16, LineHeight);
             drawCell(canvas, row, 1, 128, ry, 128 - 16, LineHeight);   // value stays in its column
-            int ri;
-            if (modulatedRow(row, ri)) {
+            int routeIndex;
+            if (modulatedRow(row, routeIndex)) {
                 // every modulated row overlays: value | narrow bar | source(right)
-                drawModulatedRow(canvas, row, ry);
+                drawModulatedRow(canvas, row, routeIndex, ry);
             }
         }
     }
@@ -353,8 +357,7 @@ void ListPage::setTopRow(int row) {
 }
 
 void ListPage::drawCell(Canvas &canvas, int row, int column, int x, int y, int w, int h) {
-    FixedStringBuilder<32> str;
-    _listModel->cell(row, column, str);
+    const char *str = cellText(row, column);
     canvas.setFont(Font::Small);
     canvas.setBlendMode(BlendMode::Set);
     bool highlight = column == int(_edit) && row == _selectedRow;
@@ -367,6 +370,30 @@ void ListPage::drawCell(Canvas &canvas, int row, int column, int x, int y, int w
     canvas.drawText(x, y + 7, str);
 }
 
+const char *ListPage::cellText(int row, int column) {
+    // visible rows are consecutive, so row % LineCount gives each its own slot
+    auto &cell = _cellCache[row % LineCount][column];
+    uint64_t revision = 0;
+    bool cacheable = _listModel->cellRevision(row, column, revision);
+    if (cacheable && cell.row == row && cell.revision == revision) {
+        return cell.text;
+    }
+    FixedStringBuilder<sizeof(cell.text)> str;
+    _listModel->cell(row, column, str);
+    std::strcpy(cell.text, str);
+    cell.row = cacheable ? row : -1;
+    cell.revision = revision;
+    return cell.text;
+}
+
+void ListPage::invalidateCellCache() {
+    for (auto &line : _cellCache) {
+        for (auto &cell : line) {
+            cell.row = -1;
+        }
+    }
+}
+
 bool ListPage::modulatedRow(int row, int &routeIndex) const {
     routeIndex = -1;
     Routing::Target target = _listModel->routingTarget(row);
@@ -480,12 +507,7 @@ void ListPage::cancelModEditIfOwner() {
     }
 }
 
-void ListPage::drawModulatedRow(Canvas &canvas, int row, int y) {
-    int routeIndex;
-    if (!modulatedRow(row, routeIndex)) {
-        return;
-    }
-
+void ListPage::drawModulatedRow(Canvas &canvas, int row, int routeIndex, int y) {
     int trackIndex = _project.selectedTrackIndex();
 
     // The draft belongs to the row actually being edited (selected + owner); every other
@@ -510,9 +532,7 @@ void ListPage::drawModulatedRow(Canvas &canvas, int row, int y) {
 
     // value stays in the normal value column (drawn by the default drawCell); measure it so the
     // bar starts after it. Layout: name | VALUE (its column) | [narrow bar] | SOURCE (right).
-    FixedStringBuilder<16> valStr;
-    _listModel->cell(row, 1, valStr);
-    int valueEnd = 128 + canvas.textWidth(valStr);
+    int valueEnd = 128 + canvas.textWidth(cellText(row, 1));
 
     // source abbrev, right-aligned at the far edge (before the scrollbar)
     FixedStringBuilder<8> srcStr;
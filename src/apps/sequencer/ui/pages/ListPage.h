@@ -38,7 +38,12 @@ protected:
     virtual void drawCell(Canvas &canvas, int row, int column, int x, int y, int w, int h);
 
 private:
-    void drawModulatedRow(Canvas &canvas, int row, int y);
+    void drawModulatedRow(Canvas &canvas, int row, int routeIndex, int y);
+
+    // Formatted text of a visible cell. Cells whose model reports a revision are
+    // only re-formatted when the revision changes.
+    const char *cellText(int row, int column);
+    void invalidateCellCache();
 
     // SPREAD sub-view (Shift+S5 on a migrated row): full-frame per-track depth
     // editor over the owner-guarded draft. enterSpread ensures a draft is active,
@@ -75,7 +80,14 @@ private:
     static constexpr int LineHeight = 10;
     static constexpr int LineCount = 4;
 
+    struct CachedCell {
+        int16_t row;
+        uint64_t revision;
+        char text[32];
+    };
+
     ListModel *_listModel;
+    CachedCell _cellCache[LineCount][2];
     int _selectedRow = 0;
     int _displayRow = 0;
     bool _edit = false;
@@ -88,7 +88,7 @@ void ModulatorPage::drawGeodeVoice(Canvas &canvas, int voice) {
     // Rolling scope of the voice output (same trace as every modulator page).
     {
         const int boxX = 1, boxY = 12, boxW = 119, boxH = 40;
-        int v = _engine.modulatorEngine().currentValue(_selectedModulator);
+        int v = _engine.snapshot().modulatorValues[_selectedModulator];
         _scope[_scopeWrite] = clamp((v - 64) * 2, -127, 127);
         _scopeWrite = (_scopeWrite + 1) % ScopeWidth;
         canvas.setBlendMode(BlendMode::Set);
@@ -370,9 +370,9 @@ void ModulatorPage::draw(Canvas &canvas) {
     // --- Left half: real-time scope of the modulator output (rolling trace, no level bar) ---
     {
         const int boxX = 1, boxY = 12, boxW = 119, boxH = 40;
-        // Sample the live output (0..127, centered 64) into the rolling history, scaled to
+        // Sample the output of the last engine frame (0..127, centered 64) into the rolling history, scaled to
         // +/-127 so the full swing fills the box. Same trace draw as the Monitor scope.
-        int v = _engine.modulatorEngine().currentValue(_selectedModulator);
+        int v = _engine.snapshot().modulatorValues[_selectedModulator];
         _scope[_scopeWrite] = clamp((v - 64) * 2, -127, 127);
         _scopeWrite = (_scopeWrite + 1) % ScopeWidth;
 
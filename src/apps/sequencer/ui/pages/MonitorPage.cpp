@@ -28,6 +28,8 @@
 #include "core/math/Math.h"
 #include "core/utils/StringBuilder.h"
 
+#include <algorithm>
+
 // ARM sizeof probes — temporary, remove after recording phase 2 measurements
 
 enum class Function {
@@ -270,7 +272,7 @@ void MonitorPage::drawCvOut(Canvas &canvas) {
         canvas.drawTextCentered(x, y - h, w, h, str);
 
         str.reset();
-        str("%.2fV", _engine.cvOutput().channel(i));
+        str("%.2fV", _engine.snapshot().cvOutput[i]);
         canvas.drawTextCentered(x, y, w, h, str);
     }
 }
@@ -309,7 +311,8 @@ void MonitorPage::drawStats(Canvas &canvas) {
     }
 
     {
-        FixedStringBuilder<16> str("%d", stats.usbMidiRxOverflow);
+        // rx/tx dropped messages and deepest output queue (events)
+        FixedStringBuilder<32> str("%d/%d Q%d", stats.usbMidiRxOverflow, stats.usbMidiTxOverflow, stats.usbMidiTxQueueHighWater);
         drawValue(2, "USBMIDI OVF:", str);
     }
 
@@ -331,6 +334,16 @@ void MonitorPage::drawStats(Canvas &canvas) {
         }
     }
 
+    {
+        // Gate/CV events dropped by full track event queues, per track.
+        FixedStringBuilder<32> str;
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            uint32_t overflows = _engine.trackEngine(trackIndex).eventQueueOverflows();
+            str(trackIndex == 0 ? "%u" : " %u", std::min<uint32_t>(overflows, 99));
+        }
+        drawValue(4, "QUEUE OVF:", str);
+    }
+
 }
 
 void MonitorPage::drawVersion(Canvas &canvas) {
@@ -343,13 +356,14 @@ void MonitorPage::drawVersion(Canvas &canvas) {
 void MonitorPage::sampleScope() {
     // Store normalized int8 (+/-127 = +/-6V) for the shared scope trace; keep the raw
     // primary CV for the numeric readout.
-    float cv = _engine.cvOutput().channel(_scopeChannel);
+    const auto &snapshot = _engine.snapshot();
+    float cv = snapshot.cvOutput[_scopeChannel];
     _scopeLastCv = cv;
     _scopeCv[_scopeWriteIndex] = int8_t(clamp(int(cv / 6.f * 127.f), -127, 127));
-    _scopeGate[_scopeWriteIndex] = (_engine.gateOutput() >> _scopeChannel) & 1;
+    _scopeGate[_scopeWriteIndex] = snapshot.gate(_scopeChannel);
 
     if (_scopeSecondaryChannel >= 0) {
-        float cvSec = _engine.cvOutput().channel(_scopeSecondaryChannel);
+        float cvSec = snapshot.cvOutput[_scopeSecondaryChannel];
         _scopeCvSecondary[_scopeWriteIndex] = int8_t(clamp(int(cvSec / 6.f * 127.f), -127, 127));
     } else {
         _scopeCvSecondary[_scopeWriteIndex] = 0;
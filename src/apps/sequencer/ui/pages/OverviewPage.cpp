@@ -17,10 +17,10 @@
 
 #include "ui/painters/WindowPainter.h"
 
-static void drawNoteTrack(Canvas &canvas, int trackIndex, const NoteTrackEngine &trackEngine, const NoteSequence &sequence) {
+static void drawNoteTrack(Canvas &canvas, int trackIndex, int currentStep, const NoteSequence &sequence) {
     canvas.setBlendMode(BlendMode::Set);
 
-    int stepOffset = (std::max(0, trackEngine.currentStep()) / 16) * 16;
+    int stepOffset = (std::max(0, currentStep) / 16) * 16;
     int y = trackIndex * 8;
 
     for (int i = 0; i < 16; ++i) {
@@ -29,7 +29,7 @@ static void drawNoteTrack(Canvas &canvas, int trackIndex, const NoteTrackEngine
 
         int x = 64 + i * 8;
 
-        if (trackEngine.currentStep() == stepIndex) {
+        if (currentStep == stepIndex) {
             canvas.setColor(step.gate() ? Color::Bright : Color::MediumBright);
             canvas.fillRect(x + 1, y + 1, 6, 6);
         } else {
@@ -66,11 +66,11 @@ static void drawCurve(Canvas &canvas, int x, int y, int w, int h, float &lastY,
     lastY = fy0;
 }
 
-static void drawCurveTrack(Canvas &canvas, int trackIndex, const CurveTrackEngine &trackEngine, const CurveTrack &curveTrack, const CurveSequence &sequence) {
+static void drawCurveTrack(Canvas &canvas, int trackIndex, int currentStep, const CurveTrackEngine &trackEngine, const CurveTrack &curveTrack, const CurveSequence &sequence) {
     canvas.setBlendMode(BlendMode::Add);
     canvas.setColor(Color::MediumBright);
 
-    int stepOffset = (std::max(0, trackEngine.currentStep()) / 16) * 16;
+    int stepOffset = (std::max(0, currentStep) / 16) * 16;
     int y = trackIndex * 8;
 
     float lastY = -1.f;
@@ -97,8 +97,8 @@ static void drawCurveTrack(Canvas &canvas, int trackIndex, const CurveTrackEngin
         }
     } else {
         // draw normal cursor
-        if (trackEngine.currentStep() >= 0) {
-            int x = 64 + ((trackEngine.currentStep() - stepOffset) + trackEngine.currentStepFraction()) * 8;
+        if (currentStep >= 0) {
+            int x = 64 + ((currentStep - stepOffset) + trackEngine.currentStepFraction()) * 8;
             canvas.setBlendMode(BlendMode::Set);
             canvas.setColor(Color::Bright);
             canvas.vline(x, y + 1, 7);
@@ -106,11 +106,10 @@ static void drawCurveTrack(Canvas &canvas, int trackIndex, const CurveTrackEngin
     }
 }
 
-static void drawTuesdayTrack(Canvas &canvas, int trackIndex, const TuesdayTrackEngine &trackEngine, const TuesdaySequence &tuesdaySequence) {
+static void drawTuesdayTrack(Canvas &canvas, int trackIndex, int currentStep, const TuesdayTrackEngine &trackEngine, const TuesdaySequence &tuesdaySequence) {
     canvas.setBlendMode(BlendMode::Set);
 
     int y = trackIndex * 8;
-    int currentStep = trackEngine.currentStep();
     int loopLength = tuesdaySequence.actualLoopLength();
     int currentStepForDisplay = currentStep;
     // Wrap current step to actual loop length if needed
@@ -162,7 +161,7 @@ static void drawTuesdayTrack(Canvas &canvas, int trackIndex, const TuesdayTrackE
     }
 }
 
-static void drawIndexedTrack(Canvas &canvas, int trackIndex, const IndexedTrackEngine &trackEngine, const IndexedSequence &sequence) {
+static void drawIndexedTrack(Canvas &canvas, int trackIndex, int currentStep, const IndexedSequence &sequence) {
     // Adaptation from IndexedSequenceEditPage timeline bar (lines 66-121)
     canvas.setBlendMode(BlendMode::Set);
 
@@ -203,7 +202,7 @@ static void drawIndexedTrack(Canvas &canvas, int trackIndex, const IndexedTrackE
                 stepW = minStepW + extraW;
             }
 
-            bool active = (trackEngine.currentStep() == i);
+            bool active = (currentStep == i);
 
             // Draw step rectangle
             canvas.setColor(active ? Color::Bright : Color::Medium);
@@ -362,7 +361,7 @@ static void drawPhaseFluxTrack(Canvas &canvas, int trackIndex, const PhaseFluxTr
     }
 }
 
-static void drawStochasticTrack(Canvas &canvas, int trackIndex, const StochasticTrackEngine &trackEngine, const StochasticSequence &sequence) {
+static void drawStochasticTrack(Canvas &canvas, int trackIndex, int currentStep, const StochasticSequence &sequence) {
     // Loop window as cells with the audible step highlighted. Mirrors drawNoteTrack's
     // row, bounded to the Stochastic [first, last] window. Audible-step math from
     // StochasticSequenceEditPage (currentStep is the NEXT step; step back one).
@@ -380,7 +379,7 @@ static void drawStochasticTrack(Canvas &canvas, int trackIndex, const Stochastic
     int winFirst = std::max(0, std::min(first, size - 1));
     int winLast = std::max(winFirst, std::min(last, size - 1));
     int winSize = std::max(1, winLast - winFirst + 1);
-    int relNext = ((trackEngine.currentStep() - winFirst) % winSize + winSize) % winSize;
+    int relNext = ((currentStep - winFirst) % winSize + winSize) % winSize;
     int audible = winFirst + (relNext - 1 + winSize) % winSize;
 
     bool haveContent = sequence.rhythmValid() || sequence.melodyValid();
@@ -426,6 +425,9 @@ void OverviewPage::draw(Canvas &canvas) {
         const auto &track = _project.track(trackIndex);
         const auto &trackState = _project.playState().trackState(trackIndex);
         const auto &trackEngine = _engine.trackEngine(trackIndex);
+        // step position of the same engine frame as the gate and cv below
+        const auto &trackSnapshot = _engine.snapshot().track(trackIndex);
+        int currentStep = trackSnapshot.trackMode == track.trackMode() ? trackSnapshot.currentStep : -1;
 
         canvas.setBlendMode(BlendMode::Set);
         canvas.setColor(Color::Medium);
@@ -438,34 +440,34 @@ void OverviewPage::draw(Canvas &canvas) {
         canvas.drawText(18, y, FixedStringBuilder<8>("P%d", trackState.pattern() + 1));
 
         // gate output
-        bool gate = _engine.gateOutput() & (1 << trackIndex);
+        bool gate = _engine.snapshot().gate(trackIndex);
         canvas.setColor(gate ? Color::Bright : Color::Medium);
         canvas.fillRect(256 - 48 + 1, trackIndex * 8 + 1, 6, 6);
 
         // cv output
         canvas.setColor(Color::Bright);
-        canvas.drawText(256 - 32, y, FixedStringBuilder<8>("%.2fV", _engine.cvOutput().channel(trackIndex)));
+        canvas.drawText(256 - 32, y, FixedStringBuilder<8>("%.2fV", _engine.snapshot().cvOutput[trackIndex]));
 
         switch (track.trackMode()) {
         case Track::TrackMode::Note:
-            drawNoteTrack(canvas, trackIndex, trackEngine.as<NoteTrackEngine>(), track.noteTrack().sequence(trackState.pattern()));
+            drawNoteTrack(canvas, trackIndex, currentStep, track.noteTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::Curve:
-            drawCurveTrack(canvas, trackIndex, trackEngine.as<CurveTrackEngine>(), track.curveTrack(), track.curveTrack().sequence(trackState.pattern()));
+            drawCurveTrack(canvas, trackIndex, currentStep, trackEngine.as<CurveTrackEngine>(), track.curveTrack(), track.curveTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::MidiCv:
             break;
         case Track::TrackMode::Tuesday:
-            drawTuesdayTrack(canvas, trackIndex, trackEngine.as<TuesdayTrackEngine>(), track.tuesdayTrack().sequence(trackState.pattern()));
+            drawTuesdayTrack(canvas, trackIndex, currentStep, trackEngine.as<TuesdayTrackEngine>(), track.tuesdayTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::DiscreteMap:
             drawDiscreteMapTrack(canvas, trackIndex, trackEngine.as<DiscreteMapTrackEngine>(), track.discreteMapTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::Indexed:
-            drawIndexedTrack(canvas, trackIndex, trackEngine.as<IndexedTrackEngine>(), track.indexedTrack().sequence(trackState.pattern()));
+            drawIndexedTrack(canvas, trackIndex, currentStep, track.indexedTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::Stochastic:
-            drawStochasticTrack(canvas, trackIndex, trackEngine.as<StochasticTrackEngine>(), track.stochasticTrack().sequence(trackState.pattern()));
+            drawStochasticTrack(canvas, trackIndex, currentStep, track.stochasticTrack().sequence(trackState.pattern()));
             break;
         case Track::TrackMode::Fractal:
             drawFractalTrack(canvas, trackIndex, trackEngine.as<FractalTrackEngine>(), track.fractalTrack().sequence(trackState.pattern()));
@@ -367,11 +367,8 @@ void PatternPage::pastePattern() {
 }
 
 void PatternPage::duplicatePattern() {
-    if (_project.selectedPatternIndex() < CONFIG_PATTERN_COUNT - 1) {
-        _model.clipBoard().copyPattern(_project.selectedPatternIndex());
+    if (_project.duplicatePattern(_project.selectedPatternIndex())) {
         _project.editSelectedPatternIndex(1, false);
-        _model.clipBoard().pastePattern(_project.selectedPatternIndex());
-        _model.clipBoard().clear();
         showMessage("PATTERN DUPLICATED");
     }
 }
@@ -47,7 +47,7 @@ void PerformerPage::draw(Canvas &canvas) {
     canvas.setBlendMode(BlendMode::Set);
 
     for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
-        const auto &trackEngine = _engine.trackEngine(trackIndex);
+        const auto &trackSnapshot = _engine.snapshot().track(trackIndex);
         const auto &trackState = playState.trackState(trackIndex);
 
         int x = trackIndex * 32;
@@ -66,7 +66,7 @@ void PerformerPage::draw(Canvas &canvas) {
         y += 8;
 
         // draw outer rectangle (track activity)
-        canvas.setColor(trackEngine.activity() ? Color::Bright : Color::Medium);
+        canvas.setColor(trackSnapshot.activity ? Color::Bright : Color::Medium);
         canvas.drawRect(x, y, w, h);
 
         // draw mutes and mute requests
@@ -79,7 +79,7 @@ void PerformerPage::draw(Canvas &canvas) {
         }
 
         // draw sequence progress
-        SequencePainter::drawSequenceProgress(canvas, x, y + h + 2, w, 2, trackEngine.sequenceProgress());
+        SequencePainter::drawSequenceProgress(canvas, x, y + h + 2, w, 2, trackSnapshot.sequenceProgress);
 
         // draw fill & fill amount amount
         bool pressed = pageKeyState()[MatrixMap::fromStep(trackIndex)];
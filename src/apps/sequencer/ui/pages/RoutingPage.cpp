@@ -842,7 +842,7 @@ void RoutingPage::drawBus(Canvas &canvas) {
             canvas.fillRect(0, y - 1, 2, rowH - 1);
         }
         // fixed LEVEL block: lane label, bipolar bar, right-aligned value
-        float volts = _engine.busCv(lane);
+        float volts = _engine.snapshot().busCv[lane];
         canvas.setColor(focus ? Color::Bright : Color::Medium);
         FixedStringBuilder<4> label("B%d", lane + 1);
         canvas.drawText(6, y + 4, label);
@@ -887,7 +887,7 @@ void RoutingPage::drawBus(Canvas &canvas) {
         }
 
         // group 2: CVR / TT activity lights (set up elsewhere, lit when writing this frame)
-        uint8_t writers = _engine.busWriters(lane);
+        uint8_t writers = _engine.snapshot().busWriters[lane];
         canvas.setColor((writers & Engine::BusWriterCvRouter) ? Color::Bright : Color::Low);
         canvas.drawText(CVR_X, y + 4, "CVR");
         canvas.setColor((writers & Engine::BusWriterTeletype) ? Color::Bright : Color::Low);
@@ -3,6 +3,9 @@
 #include "ui/pages/Pages.h"
 #include "ui/painters/WindowPainter.h"
 
+#include "model/ModelUtils.h"
+
+#include "core/profiler/TaskTelemetry.h"
 #include "core/utils/StringBuilder.h"
 
 #ifdef PLATFORM_STM32
@@ -86,9 +89,13 @@ void SystemPage::draw(Canvas &canvas) {
         break;
     }
     case Mode::Info: {
-        WindowPainter::drawActiveFunction(canvas, "INFO");
+        WindowPainter::drawActiveFunction(canvas, _infoTasks ? "INFO TASKS" : "INFO");
         WindowPainter::drawFooter(canvas, functionNames, pageKeyState(), int(_mode));
-        drawInfoSizes(canvas);
+        if (_infoTasks) {
+            drawInfoTasks(canvas);
+        } else {
+            drawInfoSizes(canvas);
+        }
         break;
     }
     case Mode::Utilities: {
@@ -195,6 +202,8 @@ void SystemPage::keyPress(KeyPressEvent &event) {
                 setMode(Mode::Calibration);
                 break;
             case Function::Info:
+                // pressing INFO again toggles between memory and task stats
+                _infoTasks = _mode == Mode::Info && !_infoTasks;
                 setMode(Mode::Info);
                 break;
             case Function::Utilities:
@@ -222,6 +231,9 @@ void SystemPage::keyPress(KeyPressEvent &event) {
         updateOutputs();
         break;
     case Mode::Info:
+        if (_infoTasks && key.isEncoder()) {
+            TaskTelemetry::resetMax();
+        }
         break;
     case Mode::Utilities:
         if (key.isEncoder()) {
@@ -245,6 +257,9 @@ void SystemPage::encoder(EncoderEvent &event) {
         updateOutputs();
         break;
     case Mode::Info:
+        if (_infoTasks) {
+            _engine.setTickCatchUpPolicy(ModelUtils::adjustedEnum(_engine.tickCatchUpPolicy(), event.value()));
+        }
         break;
     case Mode::Utilities:
         ListPage::encoder(event);
@@ -347,6 +362,56 @@ void SystemPage::drawInfoSizes(Canvas &canvas) {
 #endif
 }
 
+void SystemPage::drawInfoTasks(Canvas &canvas) {
+    const auto &stats = TaskTelemetry::stats();
+
+    canvas.setBlendMode(BlendMode::Set);
+    canvas.setFont(Font::Tiny);
+
+    auto drawRight = [&] (int x, int y, const char *text) {
+        canvas.drawText(x - canvas.textWidth(text), y, text);
+    };
+
+    int y = 14;
+    const int lineHeight = 8;
+
+    // engine timing: release latency and tick backlog (now/max), tick catch-up policy
+    const int fieldWidth = (Width - 16) / 3;
+    auto drawField = [&] (int index, const char *label, const char *value) {
+        int x = 8 + index * fieldWidth;
+        canvas.setColor(Color::Medium);
+        canvas.drawText(x, y, label);
+        canvas.setColor(Color::Bright);
+        drawRight(x + fieldWidth - 8, y, value);
+    };
+
+    FixedStringBuilder<16> latencyStr("%u/%uus", unsigned(stats.releaseLatency), unsigned(stats.releaseLatencyMax));
+    FixedStringBuilder<16> backlogStr("%u/%u", unsigned(stats.tickBacklog), unsigned(stats.tickBacklogMax));
+    drawField(0, "LATENCY", latencyStr);
+    drawField(1, "BACKLOG", backlogStr);
+    drawField(2, "CATCH-UP", TickCatchUp::policyName(_engine.tickCatchUpPolicy()));
+    y += lineHeight;
+
+    const int rows = (TaskTelemetry::MaxTasks + 1) / 2;
+    for (int i = 0; i < stats.taskCount; ++i) {
+        const auto &task = stats.tasks[i];
+        int x = 8 + (i / rows) * (Width / 2);
+        int ty = y + (i % rows) * lineHeight;
+
+        canvas.setColor(Color::Medium);
+        canvas.drawText(x, ty, task.name);
+        canvas.setColor(Color::Bright);
+        FixedStringBuilder<8> loadStr("%u.%u%%", unsigned(task.cpuLoad / 10), unsigned(task.cpuLoad % 10));
+        drawRight(x + 68, ty, loadStr);
+        if (task.stackSize > 0) {
+            FixedStringBuilder<12> stackStr("%u/%u", unsigned(task.stackFree), unsigned(task.stackSize));
+            drawRight(x + Width / 2 - 16, ty, stackStr);
+        } else {
+            drawRight(x + Width / 2 - 16, ty, "-");
+        }
+    }
+}
+
 void SystemPage::executeUtilityItem(UtilitiesListModel::Item item) {
     switch (item) {
     case UtilitiesListModel::FormatSdCard:
@@ -38,6 +38,7 @@ private:
     void updateOutputs();
 
     void drawInfoSizes(Canvas &canvas);
+    void drawInfoTasks(Canvas &canvas);
 
     void executeUtilityItem(UtilitiesListModel::Item item);
 
@@ -56,6 +57,7 @@ private:
     void restoreSettingsFromFile();
 
     Mode _mode = Mode::Calibration;
+    bool _infoTasks = false;
     Settings &_settings;
 
     int _outputIndex;
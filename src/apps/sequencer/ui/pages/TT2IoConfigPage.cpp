@@ -128,36 +128,36 @@ void TT2IoConfigPage::editCell(int delta) {
     if (!isTt2()) return;
     auto &track = _project.selectedTrack();
     const int scene = activeScene();
-    _engine.lock();
-    if (_view == View::Outputs) {
-        int i = _row;
-        switch (_col) {
-        case 0:
-            tt2SetCvOutputRange(track, i, ModelUtils::adjustedEnum(tt2CvOutputRange(track, i, scene), delta), scene);
-            break;
-        case 1:
-            tt2SetCvOutputQuantizeScale(track, i, int8_t(clamp(int(tt2CvOutputQuantizeScale(track, i, scene)) + delta, -1, Scale::Count - 1)), scene);
-            break;
-        case 2:
-            tt2SetCvOutputOffset(track, i, int16_t(clamp(int(tt2CvOutputOffset(track, i, scene)) + delta * 5, -500, 500)), scene);
-            break;
-        case 3:
-            tt2SetCvOutputRootNote(track, i, int8_t(clamp(int(tt2CvOutputRootNote(track, i, scene)) + delta, -1, 11)), scene);
-            break;
-        }
-    } else {
-        switch (_col) {
-        case 0:
-            tt2SetTriggerSource(track, _row, ModelUtils::adjustedEnum(tt2TriggerSource(track, _row, scene), delta), scene);
-            break;
-        case 1:
-            tt2SetCvInputSource(track, _row, ModelUtils::adjustedEnum(tt2CvInputSource(track, _row, scene), delta), scene);
-            break;
-        default:
-            break;  // MIDI source edit deferred
+    _engine.invoke([&] () {
+        if (_view == View::Outputs) {
+            int i = _row;
+            switch (_col) {
+            case 0:
+                tt2SetCvOutputRange(track, i, ModelUtils::adjustedEnum(tt2CvOutputRange(track, i, scene), delta), scene);
+                break;
+            case 1:
+                tt2SetCvOutputQuantizeScale(track, i, int8_t(clamp(int(tt2CvOutputQuantizeScale(track, i, scene)) + delta, -1, Scale::Count - 1)), scene);
+                break;
+            case 2:
+                tt2SetCvOutputOffset(track, i, int16_t(clamp(int(tt2CvOutputOffset(track, i, scene)) + delta * 5, -500, 500)), scene);
+                break;
+            case 3:
+                tt2SetCvOutputRootNote(track, i, int8_t(clamp(int(tt2CvOutputRootNote(track, i, scene)) + delta, -1, 11)), scene);
+                break;
+            }
+        } else {
+            switch (_col) {
+            case 0:
+                tt2SetTriggerSource(track, _row, ModelUtils::adjustedEnum(tt2TriggerSource(track, _row, scene), delta), scene);
+                break;
+            case 1:
+                tt2SetCvInputSource(track, _row, ModelUtils::adjustedEnum(tt2CvInputSource(track, _row, scene), delta), scene);
+                break;
+            default:
+                break;  // MIDI source edit deferred
+            }
         }
-    }
-    _engine.unlock();
+    });
 }
 
 void TT2IoConfigPage::draw(Canvas &canvas) {
@@ -345,16 +345,16 @@ void TeletypePatternViewPage::keyboard(KeyboardEvent &event) {
             if (_editingNumber) {
                 _editBuffer = tt2TransposeSemitones(int16_t(_editBuffer), interval);
             } else {
-                _engine.lock();
-                pat.val[_row] = tt2TransposeSemitones(pat.val[_row], interval);
-                _engine.unlock();
+                _engine.invoke([&] () {
+                    pat.val[_row] = tt2TransposeSemitones(pat.val[_row], interval);
+                });
             }
         } else {
-            _engine.lock();
-            int16_t v = pat.val[_row];
-            pat.val[_row] = dir > 0 ? (v == INT16_MAX ? INT16_MIN : int16_t(v + 1))
-                                    : (v == INT16_MIN ? INT16_MAX : int16_t(v - 1));
-            _engine.unlock();
+            _engine.invoke([&] () {
+                int16_t v = pat.val[_row];
+                pat.val[_row] = dir > 0 ? (v == INT16_MAX ? INT16_MIN : int16_t(v + 1))
+                                        : (v == INT16_MIN ? INT16_MAX : int16_t(v - 1));
+            });
             _editingNumber = false;
         }
         event.consume();
@@ -371,9 +371,9 @@ void TeletypePatternViewPage::keyboard(KeyboardEvent &event) {
             _editBuffer = tt2TransposeSemitones(int16_t(_editBuffer), interval);
         } else {
             auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-            _engine.lock();
-            pat.val[_row] = tt2TransposeSemitones(pat.val[_row], interval);
-            _engine.unlock();
+            _engine.invoke([&] () {
+                pat.val[_row] = tt2TransposeSemitones(pat.val[_row], interval);
+            });
         }
         event.consume();
         return;
@@ -434,9 +434,9 @@ void TeletypePatternViewPage::keyboard(KeyboardEvent &event) {
             // Paste value
             {
                 auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-                _engine.lock();
-                pat.val[_row] = _valueCopyBuffer;
-                _engine.unlock();
+                _engine.invoke([&] () {
+                    pat.val[_row] = _valueCopyBuffer;
+                });
                 _editingNumber = false;
             }
             event.consume();
@@ -542,9 +542,9 @@ void TeletypePatternViewPage::keyboard(KeyboardEvent &event) {
     // Space: toggle between 0 and 1
     if (keycode == KeyboardEvent::KeySpace) {
         auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-        _engine.lock();
-        pat.val[_row] = pat.val[_row] ? 0 : 1;
-        _engine.unlock();
+        _engine.invoke([&] () {
+            pat.val[_row] = pat.val[_row] ? 0 : 1;
+        });
         _editingNumber = false;
         event.consume();
         return;
@@ -602,12 +602,12 @@ void TeletypePatternViewPage::commitEdit() {
     }
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
     int16_t value = clamp<int32_t>(_editBuffer, INT16_MIN, INT16_MAX);
-    _engine.lock();
-    pat.val[_row] = value;
-    if (_row >= int(pat.len) && pat.len < TT2_PATTERN_LENGTH) {
-        pat.len = uint16_t(_row + 1);
-    }
-    _engine.unlock();
+    _engine.invoke([&] () {
+        pat.val[_row] = value;
+        if (_row >= int(pat.len) && pat.len < TT2_PATTERN_LENGTH) {
+            pat.len = uint16_t(_row + 1);
+        }
+    });
     _editingNumber = false;
 }
 
@@ -635,24 +635,24 @@ void TeletypePatternViewPage::insertRow() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
     const int idx = _row;
 
-    _engine.lock();
-    const int len = int(pat.len);
-    const int16_t value = pat.val[idx];
-    const int maxIndex = std::min<int>(len, TT2_PATTERN_LENGTH - 1);
+    _engine.invoke([&] () {
+        const int len = int(pat.len);
+        const int16_t value = pat.val[idx];
+        const int maxIndex = std::min<int>(len, TT2_PATTERN_LENGTH - 1);
 
-    if (maxIndex >= idx) {
-        for (int i = maxIndex; i > idx; --i) {
-            pat.val[i] = pat.val[i - 1];
-        }
-        if (len < TT2_PATTERN_LENGTH - 1) {
-            pat.len = uint16_t(len + 1);
+        if (maxIndex >= idx) {
+            for (int i = maxIndex; i > idx; --i) {
+                pat.val[i] = pat.val[i - 1];
+            }
+            if (len < TT2_PATTERN_LENGTH - 1) {
+                pat.len = uint16_t(len + 1);
+            }
+        } else if (idx >= len && idx < TT2_PATTERN_LENGTH) {
+            pat.len = uint16_t(idx + 1);
         }
-    } else if (idx >= len && idx < TT2_PATTERN_LENGTH) {
-        pat.len = uint16_t(idx + 1);
-    }
 
-    pat.val[idx] = value;
-    _engine.unlock();
+        pat.val[idx] = value;
+    });
     _editingNumber = false;
 }
 
@@ -660,21 +660,22 @@ void TeletypePatternViewPage::deleteRow() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
     const int idx = _row;
 
-    _engine.lock();
-    const int len = int(pat.len);
+    int len = 0;
+    int newLen = 0;
+    _engine.invoke([&] () {
+        len = int(pat.len);
+        newLen = len;
+        if (len > 0 && idx < len) {
+            for (int i = idx; i < len - 1; ++i) {
+                pat.val[i] = pat.val[i + 1];
+            }
+            newLen = len - 1;
+            pat.len = uint16_t(newLen);
+        }
+    });
     if (len <= 0) {
-        _engine.unlock();
         return;
     }
-    int newLen = len;
-    if (idx < len) {
-        for (int i = idx; i < len - 1; ++i) {
-            pat.val[i] = pat.val[i + 1];
-        }
-        newLen = len - 1;
-        pat.len = uint16_t(newLen);
-    }
-    _engine.unlock();
     int maxRow = std::max<int>(newLen - 1, 0);
     _row = clamp(_row, 0, maxRow);
     ensureRowVisible();
@@ -693,40 +694,40 @@ void TeletypePatternViewPage::negateValue() {
 
 void TeletypePatternViewPage::toggleTurtle() {
     auto &runtime = _project.selectedTrack().tt2Track().runtime();
-    _engine.lock();
-    runtime.turtle.shown = runtime.turtle.shown ? 0 : 1;
-    _engine.unlock();
+    _engine.invoke([&] () {
+        runtime.turtle.shown = runtime.turtle.shown ? 0 : 1;
+    });
 }
 
 void TeletypePatternViewPage::setLength() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-    _engine.lock();
-    pat.len = uint16_t(clamp(_row + 1, 0, TT2_PATTERN_LENGTH));
-    _engine.unlock();
+    _engine.invoke([&] () {
+        pat.len = uint16_t(clamp(_row + 1, 0, TT2_PATTERN_LENGTH));
+    });
     _editingNumber = false;
 }
 
 void TeletypePatternViewPage::setStart() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-    _engine.lock();
-    pat.start = int16_t(_row);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        pat.start = int16_t(_row);
+    });
     _editingNumber = false;
 }
 
 void TeletypePatternViewPage::setEnd() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-    _engine.lock();
-    pat.end = int16_t(_row);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        pat.end = int16_t(_row);
+    });
     _editingNumber = false;
 }
 
 void TeletypePatternViewPage::commitField() {
     auto &pat = _project.selectedTrack().tt2Track().program().patterns[_patternIndex];
-    _engine.lock();
-    if (_fieldEdit == FieldEdit::Length) pat.len = uint16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH));
-    else if (_fieldEdit == FieldEdit::Start) pat.start = int16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH - 1));
-    else if (_fieldEdit == FieldEdit::End) pat.end = int16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH - 1));
-    _engine.unlock();
+    _engine.invoke([&] () {
+        if (_fieldEdit == FieldEdit::Length) pat.len = uint16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH));
+        else if (_fieldEdit == FieldEdit::Start) pat.start = int16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH - 1));
+        else if (_fieldEdit == FieldEdit::End) pat.end = int16_t(clamp(_fieldBuffer, 0, TT2_PATTERN_LENGTH - 1));
+    });
 }
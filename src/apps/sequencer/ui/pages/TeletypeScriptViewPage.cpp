@@ -326,7 +326,7 @@ void TeletypeScriptViewPage::drawHud(Canvas &canvas) {
     drawBipolarBar(canvas, 230, 38, 4, 13, clamp(paramVal, 0, 16383), Color::MediumBright, Color::Low);
     static const int kBusX[4] = { 235, 240, 245, 250 };
     for (int i = 0; i < 4; ++i) {
-        int raw = clamp(int((_engine.busCv(i) + 5.f) / 10.f * 16383.f), 0, 16383);
+        int raw = clamp(int((_engine.snapshot().busCv[i] + 5.f) / 10.f * 16383.f), 0, 16383);
         drawBipolarBar(canvas, kBusX[i], 38, 4, 13, raw, Color::MediumLow, Color::Low);
     }
 }
@@ -821,10 +821,10 @@ void TeletypeScriptViewPage::commitLine() {
     _undoLine = _selectedLine;
     _undoLength = script.length;
     _undoCommand = script.commands[_selectedLine];
-    _engine.lock();
-    if (isMini()) setScriptCommand(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine, _editBuffer);
-    else setScriptCommand(track.tt2Track().program(), _scriptIndex, _selectedLine, _editBuffer);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        if (isMini()) setScriptCommand(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine, _editBuffer);
+        else setScriptCommand(track.tt2Track().program(), _scriptIndex, _selectedLine, _editBuffer);
+    });
     // Commit succeeded; no UI message per current workflow.
 }
 
@@ -852,13 +852,13 @@ void TeletypeScriptViewPage::duplicateLine() {
     if (_selectedLine >= tt2Script(track, _scriptIndex, scene).length) {
         return;
     }
-    _engine.lock();
-    if (isMini()) duplicateLineIn(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine);
-    else duplicateLineIn(track.tt2Track().program(), _scriptIndex, _selectedLine);
-    if (_selectedLine < kLineCount - 1) {
-        _selectedLine += 1;
-    }
-    _engine.unlock();
+    _engine.invoke([&] () {
+        if (isMini()) duplicateLineIn(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine);
+        else duplicateLineIn(track.tt2Track().program(), _scriptIndex, _selectedLine);
+        if (_selectedLine < kLineCount - 1) {
+            _selectedLine += 1;
+        }
+    });
     loadEditBuffer(_selectedLine);
 }
 
@@ -870,10 +870,10 @@ void TeletypeScriptViewPage::commentLine() {
     if (_selectedLine >= script.length) {
         return;
     }
-    _engine.lock();
-    uint8_t &c = script.commands[_selectedLine].commented;
-    c = c ? 0 : 1;
-    _engine.unlock();
+    _engine.invoke([&] () {
+        uint8_t &c = script.commands[_selectedLine].commented;
+        c = c ? 0 : 1;
+    });
 }
 
 void TeletypeScriptViewPage::deleteLine() {
@@ -893,10 +893,10 @@ void TeletypeScriptViewPage::deleteLine() {
         _undoLength = script.length;
         _undoCommand = script.commands[_selectedLine];
     }
-    _engine.lock();
-    if (isMini()) deleteScriptCommand(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine);
-    else deleteScriptCommand(track.tt2Track().program(), _scriptIndex, _selectedLine);
-    _engine.unlock();
+    _engine.invoke([&] () {
+        if (isMini()) deleteScriptCommand(track.tt2MiniTrack().program(scene), _scriptIndex, _selectedLine);
+        else deleteScriptCommand(track.tt2Track().program(), _scriptIndex, _selectedLine);
+    });
     loadEditBuffer(_selectedLine);
     showMessage("Line deleted");
 }
@@ -906,17 +906,17 @@ void TeletypeScriptViewPage::undo() {
         return;
     }
     TT2Script &script = tt2Script(_project.selectedTrack(), _scriptIndex, activeScene());
-    _engine.lock();
-    if (_undoOp == UndoOp::Overwrite) {
-        script.commands[_undoLine] = _undoCommand;
-    } else {  // Delete: re-insert the removed line, shifting the rest down
-        for (int i = _undoLength - 1; i > _undoLine; --i) {
-            script.commands[i] = script.commands[i - 1];
+    _engine.invoke([&] () {
+        if (_undoOp == UndoOp::Overwrite) {
+            script.commands[_undoLine] = _undoCommand;
+        } else {  // Delete: re-insert the removed line, shifting the rest down
+            for (int i = _undoLength - 1; i > _undoLine; --i) {
+                script.commands[i] = script.commands[i - 1];
+            }
+            script.commands[_undoLine] = _undoCommand;
         }
-        script.commands[_undoLine] = _undoCommand;
-    }
-    script.length = _undoLength;
-    _engine.unlock();
+        script.length = _undoLength;
+    });
     _undoOp = UndoOp::None;
     _selectedLine = _undoLine;
     loadEditBuffer(_undoLine);
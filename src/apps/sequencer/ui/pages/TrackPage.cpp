@@ -218,10 +218,8 @@ void TrackPage::copyTrackSetup() {
 }
 
 void TrackPage::pasteTrackSetup() {
-    // we are about to change track engines -> lock the engine to avoid inconsistent state
-    _engine.lock();
-    _model.clipBoard().pasteTrack(_project.selectedTrack());
-    _engine.unlock();
+    // we are about to change track engines -> let the engine apply the paste to avoid inconsistent state
+    _engine.invoke([this] () { _model.clipBoard().pasteTrack(_project.selectedTrack()); });
     setTrack(_project.selectedTrack());
     showMessage("TRACK PASTED");
 }
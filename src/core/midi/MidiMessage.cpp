@@ -2,6 +2,8 @@
 
 #include "core/Debug.h"
 
+#include "os/os.h"
+
 MidiMessage::PayloadPool MidiMessage::_payloadPool;
 
 void MidiMessage::dump(const MidiMessage &msg) {
@@ -54,6 +56,9 @@ MidiMessage::PayloadID MidiMessage::allocatePayload(size_t length) {
         return InvalidPayload;
     }
 
+    // messages are created and released from tasks and the usb host driver, the slot
+    // claim and the reference counts must not be interleaved
+    os::InterruptLock lock;
     for (size_t slotIndex = 0; slotIndex < _payloadPool.slots.size(); ++slotIndex) {
         auto &slot = _payloadPool.slots[slotIndex];
         if (!slot.data) {
@@ -68,6 +73,7 @@ MidiMessage::PayloadID MidiMessage::allocatePayload(size_t length) {
 }
 
 void MidiMessage::incPayloadRefCount(PayloadID id) {
+    os::InterruptLock lock;
     auto slot = _payloadPool.getSlot(id);
     if (slot) {
         slot->refCount++;
@@ -76,6 +82,7 @@ void MidiMessage::incPayloadRefCount(PayloadID id) {
 }
 
 void MidiMessage::decPayloadRefCount(PayloadID id) {
+    os::InterruptLock lock;
     auto slot = _payloadPool.getSlot(id);
     if (slot) {
         slot->refCount--;
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "MidiMessage.h"
+
+#include "core/utils/RingBuffer.h"
+
+#include <algorithm>
+
+#include <cstddef>
+#include <cstdint>
+
+// Output queue of a single USB MIDI device.
+//
+// Messages are converted to 4 byte USB-MIDI event packets when queued and
+// pack() moves as many queued events as fit into one bulk packet (16 events in
+// a 64 byte full-speed packet). SysEx is split into 3 byte chunks and may span
+// several bulk packets. A message that does not fit into the queue as a whole
+// is dropped and counted.
+template<size_t Capacity>
+class UsbMidiOutputQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    static constexpr size_t EventSize = 4;
+
+    void clear() {
+        while (!_events.empty()) {
+            _events.read();
+        }
+    }
+
+    bool empty() const { return _events.empty(); }
+    size_t entries() const { return _events.readable(); }
+
+    // queue a message, returns false if it was dropped
+    bool push(uint8_t cable, const MidiMessage &message) {
+        bool success = true;
+        if (message.isSystemExclusive()) {
+            success = pushSystemExclusive(cable, message.payloadData(), message.payloadLength());
+        } else if (_events.full()) {
+            success = false;
+        } else {
+            _events.write({{
+                uint8_t(message.status() >> 4 | cable << 4),
+                message.status(),
+                message.data0(),
+                message.data1()
+            }});
+        }
+
+        if (!success) {
+            ++_dropped;
+        }
+        _highWater = std::max(_highWater, uint32_t(entries()));
+        return success;
+    }
+
+    // move queued events into a bulk packet of up to maxSize bytes, returns the packet size
+    size_t pack(uint8_t *packet, size_t maxSize) {
+        size_t size = 0;
+        while (size + EventSize <= maxSize && !_events.empty()) {
+            Event event = _events.read();
+            for (size_t i = 0; i < EventSize; ++i) {
+                packet[size++] = event.data[i];
+            }
+        }
+        return size;
+    }
+
+    uint32_t dropped() const { return _dropped; }
+    uint32_t highWater() const { return _highWater; }
+
+private:
+    struct Event {
+        uint8_t data[EventSize];
+    };
+
+    bool pushSystemExclusive(uint8_t cable, const uint8_t *payloadData, size_t payloadLength) {
+        if (!payloadData || payloadLength == 0) {
+            return true;
+        }
+
+        size_t messageLength = payloadLength + 2;
+        if ((messageLength + 2) / 3 > _events.writable()) {
+            return false;
+        }
+
+        size_t messageIndex = 0;
+        while (messageIndex < messageLength) {
+            Event event = {};
+            size_t chunkSize;
+            switch (messageLength - messageIndex) {
+            case 1:
+                event.data[0] = 0x5;
+                chunkSize = 1;
+                break;
+            case 2:
+                event.data[0] = 0x6;
+                chunkSize = 2;
+                break;
+            case 3:
+                event.data[0] = 0x7;
+                chunkSize = 3;
+                break;
+            default:
+                event.data[0] = 0x4;
+                chunkSize = 3;
+                break;
+            }
+            event.data[0] |= cable << 4;
+            for (size_t i = 0; i < chunkSize; ++i) {
+                uint8_t byte;
+                if (messageIndex == 0) {
+                    byte = 0xf0;
+                } else if (messageIndex == messageLength - 1) {
+                    byte = 0xf7;
+                } else {
+                    byte = payloadData[messageIndex - 1];
+                }
+                event.data[1 + i] = byte;
+                ++messageIndex;
+            }
+            _events.write(event);
+        }
+        return true;
+    }
+
+    RingBuffer<Event, Capacity> _events;
+    uint32_t _dropped = 0;
+    uint32_t _highWater = 0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Reassembles a system exclusive message from USB-MIDI events (code index
+// number 0x4 starts or continues a message, 0x5, 0x6 and 0x7 end it with 1, 2
+// or 3 bytes). The assembled payload excludes the F0/F7 framing, as in
+// MidiMessage::makeSystemExclusive(). Messages with more than Capacity payload
+// bytes are dropped and counted.
+template<size_t Capacity>
+class UsbMidiSysExAssembler {
+public:
+    // feed a 4 byte SysEx event, returns true if it completed a message
+    bool feed(const uint8_t *event) {
+        size_t count;
+        switch (event[0] & 0xf) {
+        case 0x4:
+        case 0x7:
+            count = 3;
+            break;
+        case 0x6:
+            count = 2;
+            break;
+        case 0x5:
+            count = 1;
+            break;
+        default:
+            return false;
+        }
+
+        bool complete = false;
+        for (size_t i = 0; i < count; ++i) {
+            complete = feedByte(event[1 + i]);
+        }
+        return complete;
+    }
+
+    // payload of the last completed message
+    const uint8_t *data() const { return _data; }
+    size_t length() const { return _length; }
+
+    uint32_t dropped() const { return _dropped; }
+
+private:
+    bool feedByte(uint8_t byte) {
+        if (byte == 0xf0) {
+            _receiving = true;
+            _overflow = false;
+            _length = 0;
+        } else if (byte == 0xf7) {
+            bool complete = _receiving && !_overflow;
+            if (_receiving && _overflow) {
+                ++_dropped;
+            }
+            _receiving = false;
+            return complete;
+        } else if (_receiving && byte < 0x80) {
+            if (_length < Capacity) {
+                _data[_length++] = byte;
+            } else {
+                _overflow = true;
+            }
+        } else {
+            // stray status byte aborts the message
+            _receiving = false;
+        }
+        return false;
+    }
+
+    uint8_t _data[Capacity];
+    size_t _length = 0;
+    bool _receiving = false;
+    bool _overflow = false;
+    uint32_t _dropped = 0;
+};
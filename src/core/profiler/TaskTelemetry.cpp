@@ -0,0 +1,102 @@
+#include "TaskTelemetry.h"
+
+#include "core/Debug.h"
+
+#include "os/os.h"
+
+TripleBuffer<TaskTelemetry::Stats> TaskTelemetry::_stats;
+uint32_t TaskTelemetry::_sequence;
+std::atomic<uint32_t> TaskTelemetry::_releaseLatency(0);
+std::atomic<uint32_t> TaskTelemetry::_releaseLatencyMax(0);
+std::atomic<uint32_t> TaskTelemetry::_tickBacklog(0);
+std::atomic<uint32_t> TaskTelemetry::_tickBacklogMax(0);
+std::atomic<uint32_t> TaskTelemetry::_outputSkew(0);
+std::atomic<uint32_t> TaskTelemetry::_outputSkewMax(0);
+
+static void storeMax(std::atomic<uint32_t> &value, uint32_t candidate) {
+    uint32_t current = value.load(std::memory_order_relaxed);
+    while (candidate > current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {}
+}
+
+void TaskTelemetry::recordRelease(uint32_t latency) {
+    storeMax(_releaseLatency, latency);
+    storeMax(_releaseLatencyMax, latency);
+}
+
+void TaskTelemetry::recordTickBacklog(uint32_t ticks) {
+    storeMax(_tickBacklog, ticks);
+    storeMax(_tickBacklogMax, ticks);
+}
+
+void TaskTelemetry::recordOutputSkew(uint32_t skew) {
+    storeMax(_outputSkew, skew);
+    storeMax(_outputSkewMax, skew);
+}
+
+const TaskTelemetry::Stats &TaskTelemetry::sample() {
+    Stats &stats = _stats.write();
+    stats.sequence = ++_sequence;
+    stats.taskCount = 0;
+
+#if CONFIG_ENABLE_TASK_PROFILER
+    uint32_t runTimes[MaxTasks];
+    uint64_t totalRunTime = 0;
+    os::TaskProfiler::sample([&] (const char *name, uint32_t runTime, uint16_t stackSize, uint16_t stackFree) {
+        if (stats.taskCount < MaxTasks) {
+            stats.tasks[stats.taskCount] = { name, 0, stackSize, stackFree };
+            runTimes[stats.taskCount] = runTime;
+            ++stats.taskCount;
+        }
+        totalRunTime += runTime;
+    });
+    if (totalRunTime > 0) {
+        for (int i = 0; i < stats.taskCount; ++i) {
+            stats.tasks[i].cpuLoad = uint16_t((uint64_t(runTimes[i]) * 1000 + totalRunTime / 2) / totalRunTime);
+        }
+    }
+#endif // CONFIG_ENABLE_TASK_PROFILER
+
+    stats.releaseLatency = _releaseLatency.exchange(0, std::memory_order_relaxed);
+    stats.releaseLatencyMax = _releaseLatencyMax.load(std::memory_order_relaxed);
+    stats.tickBacklog = _tickBacklog.exchange(0, std::memory_order_relaxed);
+    stats.tickBacklogMax = _tickBacklogMax.load(std::memory_order_relaxed);
+    stats.outputSkew = _outputSkew.exchange(0, std::memory_order_relaxed);
+    stats.outputSkewMax = _outputSkewMax.load(std::memory_order_relaxed);
+
+    _stats.publish();
+    return stats;
+}
+
+const TaskTelemetry::Stats &TaskTelemetry::stats() {
+    _stats.update();
+    return _stats.read();
+}
+
+void TaskTelemetry::dump(const Stats &stats) {
+    DBG("Task Telemetry:");
+    DBG("---------------------------------------------");
+    DBG("name             load  stack  free");
+    for (int i = 0; i < stats.taskCount; ++i) {
+        const auto &task = stats.tasks[i];
+        DBG("%-15s %3d.%d%% %6d %5d",
+            task.name,
+            task.cpuLoad / 10,
+            task.cpuLoad % 10,
+            task.stackSize,
+            task.stackFree
+        );
+    }
+    DBG("engine release latency %lu us (max %lu us)",
+        (unsigned long)stats.releaseLatency,
+        (unsigned long)stats.releaseLatencyMax
+    );
+    DBG("engine tick backlog %lu (max %lu)",
+        (unsigned long)stats.tickBacklog,
+        (unsigned long)stats.tickBacklogMax
+    );
+    DBG("cv to gate output skew %lu us (max %lu us)",
+        (unsigned long)stats.outputSkew,
+        (unsigned long)stats.outputSkewMax
+    );
+    DBG("---------------------------------------------");
+}
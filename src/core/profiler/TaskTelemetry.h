@@ -0,0 +1,78 @@
+#pragma once
+
+#include "SystemConfig.h"
+
+#include "core/utils/TripleBuffer.h"
+
+#include <array>
+#include <atomic>
+
+#include <cstdint>
+
+// Always-on runtime statistics of the tasks: CPU load per task over the last
+// sample window, stack high-water marks, the worst release latency of the
+// engine task (how late it started after its intended 1 ms release) and the
+// largest backlog of clock ticks the engine found queued up at the start of a frame
+// and the skew between committing the cv and the gate outputs.
+//
+// The engine task records its release latency, tick backlog and output skew every period, the profiler task
+// samples the RTOS run time counters once a second and publishes the stats,
+// the ui task reads the latest published stats (system page, SysEx queries).
+class TaskTelemetry {
+public:
+    static constexpr int MaxTasks = 8;
+    static constexpr uint32_t SampleInterval = 1000; // ms
+
+    struct Task {
+        const char *name;
+        uint16_t cpuLoad;           // 0.1% of the sample window
+        uint16_t stackSize;         // bytes, 0 if unknown
+        uint16_t stackFree;         // lowest free stack since boot in bytes
+    };
+
+    struct Stats {
+        uint32_t sequence;          // number of samples taken, 0 before the first one
+        uint8_t taskCount;
+        std::array<Task, MaxTasks> tasks;
+        uint32_t releaseLatency;    // worst engine release latency in the sample window in us
+        uint32_t releaseLatencyMax; // worst engine release latency since boot (or reset) in us
+        uint32_t tickBacklog;       // largest engine tick backlog in the sample window
+        uint32_t tickBacklogMax;    // largest engine tick backlog since boot (or reset)
+        uint32_t outputSkew;        // largest cv to gate output skew in the sample window in us
+        uint32_t outputSkewMax;     // largest cv to gate output skew since boot (or reset) in us
+    };
+
+    // engine task: record the latency of the current release in us
+    static void recordRelease(uint32_t latency);
+
+    // engine task: record the number of clock ticks pending at the start of a frame
+    static void recordTickBacklog(uint32_t ticks);
+
+    // engine task: record the time between committing the cv and the gate outputs in us
+    static void recordOutputSkew(uint32_t skew);
+
+    // profiler task: sample the task counters and publish new stats, returns the published stats
+    static const Stats &sample();
+
+    // ui task: latest published stats
+    static const Stats &stats();
+
+    // ui task: restart tracking the worst release latency, tick backlog and output skew
+    static void resetMax() {
+        _releaseLatencyMax.store(0, std::memory_order_relaxed);
+        _tickBacklogMax.store(0, std::memory_order_relaxed);
+        _outputSkewMax.store(0, std::memory_order_relaxed);
+    }
+
+    static void dump(const Stats &stats);
+
+private:
+    static TripleBuffer<Stats> _stats;
+    static uint32_t _sequence;
+    static std::atomic<uint32_t> _releaseLatency;
+    static std::atomic<uint32_t> _releaseLatencyMax;
+    static std::atomic<uint32_t> _tickBacklog;
+    static std::atomic<uint32_t> _tickBacklogMax;
+    static std::atomic<uint32_t> _outputSkew;
+    static std::atomic<uint32_t> _outputSkewMax;
+};
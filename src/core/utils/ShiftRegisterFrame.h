@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+
+#include <cstdint>
+
+// Output bytes of a chain of shift registers.
+//
+// Writes are staged and go out with the next full transfer, which also loads
+// the inputs. A single register can be latched in between: the chain is then
+// shifted with the bytes of the last transfer plus the new byte, so staged
+// bytes of the other registers stay pending and the inputs are not reloaded.
+// The button matrix scan relies on exactly one full transfer per scan step.
+template<int Count>
+class ShiftRegisterFrame {
+public:
+    typedef std::array<uint8_t, Count> Bytes;
+
+    ShiftRegisterFrame() {
+        _staged.fill(0u);
+        _latched.fill(0u);
+    }
+
+    uint8_t staged(int index) const { return _staged[index]; }
+    uint8_t latched(int index) const { return _latched[index]; }
+
+    void write(int index, uint8_t value) { _staged[index] = value; }
+
+    // bytes to shift out in a full transfer, latches all staged bytes
+    const Bytes &latchAll() {
+        _latched = _staged;
+        return _latched;
+    }
+
+    // bytes to shift out to latch a single register
+    const Bytes &latch(int index, uint8_t value) {
+        _staged[index] = value;
+        _latched[index] = value;
+        return _latched;
+    }
+
+private:
+    Bytes _staged;
+    Bytes _latched;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+
+#include <cstdint>
+
+// Lock-free triple buffer between a single producer and a single consumer task.
+//
+// The producer fills the back buffer returned by write() and swaps it with the
+// middle buffer in publish(). The consumer swaps the middle buffer into its
+// front buffer in update() if a newer one was published, and reads it with
+// read() until the next update(). Neither side ever waits or sees a partially
+// written value; intermediate values are skipped if the producer publishes
+// faster than the consumer updates.
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() :
+        _middle(1)
+    {}
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    // producer: buffer to fill (keeps its content from before the last publish() but one)
+    T &write() { return _buffers[_back]; }
+
+    // producer: make the written buffer the latest one
+    void publish() {
+        _back = _middle.exchange(_back | Fresh, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    // consumer: switch to the latest published buffer, returns false if there is none since the last update
+    bool update() {
+        if (!(_middle.load(std::memory_order_relaxed) & Fresh)) {
+            return false;
+        }
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    // consumer: latest buffer as of the last update()
+    const T &read() const { return _buffers[_front]; }
+
+private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t Fresh = 0x4;
+
+    T _buffers[3] = {};
+    uint8_t _back = 0;
+    std::atomic<uint8_t> _middle;
+    uint8_t _front = 2;
+};
@@ -2,6 +2,8 @@
 
 #include "SystemConfig.h"
 
+#include "HighResolutionTimer.h"
+
 #include "sim/Simulator.h"
 
 #include <cstdint>
@@ -25,6 +27,7 @@ public:
 
     void write(int channel) {
         _simulator.writeDac(channel, _values[channel]);
+        _updateUs = HighResolutionTimer::us();
     }
 
     void write() {
@@ -33,7 +36,11 @@ public:
         }
     }
 
+    // time the outputs were last updated in us
+    uint32_t updateUs() const { return _updateUs; }
+
 private:
     sim::Simulator &_simulator;
     Value _values[Channels];
+    uint32_t _updateUs = 0;
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "HighResolutionTimer.h"
+
 #include "sim/Simulator.h"
 
 #include <cstdint>
@@ -16,8 +18,12 @@ public:
         for (int i = 0; i < 8; ++i) {
             _simulator.writeGateOutput(i, (_gates >> i) & 1);
         }
+        _latchUs = HighResolutionTimer::us();
     }
 
+    // time the gates were last latched in us
+    uint32_t latchUs() const { return _latchUs; }
+
     inline uint8_t gates() const { return _gates; }
 
     inline void setGates(uint8_t gates) {
@@ -35,4 +41,5 @@ public:
 private:
     sim::Simulator &_simulator;
     uint8_t _gates = 0;
+    uint32_t _latchUs = 0;
 };
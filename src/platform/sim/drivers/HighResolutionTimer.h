@@ -15,9 +15,36 @@ public:
     }
 
     static uint32_t us() {
+        const auto &manual = manualTime();
+        if (manual.enabled) {
+            return manual.us;
+        }
+
         auto current = std::chrono::high_resolution_clock::now();
 
         return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<double>(current - detail::start)).count();
     }
 
+    // Headless tests stop the timer at 0 and advance it by hand, so code timed
+    // by the wall clock runs the same on every host.
+    static void setManual(bool enabled) {
+        auto &manual = manualTime();
+        manual.enabled = enabled;
+        manual.us = 0;
+    }
+
+    static void advanceManual(uint32_t us) {
+        manualTime().us += us;
+    }
+
+private:
+    struct ManualTime {
+        bool enabled = false;
+        uint32_t us = 0;
+    };
+
+    static ManualTime &manualTime() {
+        static ManualTime time;
+        return time;
+    }
 };
@@ -52,6 +52,8 @@ public:
     }
 
     uint32_t rxOverflow() const { return 0; }
+    uint32_t txOverflow() const { return 0; }
+    uint32_t txQueueHighWater() const { return 0; }
 
 private:
     void writeMidiInput(sim::MidiEvent event) {
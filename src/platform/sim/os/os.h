@@ -5,15 +5,121 @@
 #include "sim/Simulator.h"
 
 #include <vector>
+#include <chrono>
 #include <functional>
 #include <mutex>
 
+#include <cstdint>
+
 namespace os {
 
     std::vector<std::function<void(void)>> &updateCallbacks();
 
     typedef int TaskHandle;
 
+    // Models the run time stats of the hardware build: a task's run time is the
+    // wall time spent in its function (in us), the rest of a sample window is
+    // accounted to the idle task. Stack usage is not known in the simulator.
+    class TaskProfiler {
+    public:
+        struct TaskInfo {
+            TaskInfo(const char *name) : name(name) {
+                registerTask(this);
+            }
+
+            ~TaskInfo() {
+                unregisterTask(this);
+            }
+
+            TaskInfo(const TaskInfo &) = delete;
+            TaskInfo &operator=(const TaskInfo &) = delete;
+
+            TaskInfo *next = nullptr;
+            const char *name;
+            uint32_t runTime = 0;
+            uint32_t lastRunTime = 0;
+        };
+
+        static void registerTask(TaskInfo *taskInfo) {
+            TaskInfo **tail = &taskInfos();
+            while (*tail != nullptr) {
+                tail = &(*tail)->next;
+            }
+            *tail = taskInfo;
+        }
+
+        static void unregisterTask(TaskInfo *taskInfo) {
+            for (TaskInfo **info = &taskInfos(); *info != nullptr; info = &(*info)->next) {
+                if (*info == taskInfo) {
+                    *info = taskInfo->next;
+                    return;
+                }
+            }
+        }
+
+        template<typename Func>
+        static void run(TaskInfo &info, Func func) {
+            uint32_t start = now();
+            func();
+            info.runTime += now() - start;
+        }
+
+        // same interface as the hardware build, stackSize and stackFree are 0
+        template<typename Func>
+        static void sample(Func func) {
+            uint32_t time = now();
+            uint32_t window = time - lastSample();
+            lastSample() = time;
+            uint32_t busy = 0;
+            for (TaskInfo *info = taskInfos(); info; info = info->next) {
+                uint32_t runTime = info->runTime - info->lastRunTime;
+                info->lastRunTime = info->runTime;
+                busy += runTime;
+                func(info->name, runTime, uint16_t(0), uint16_t(0));
+            }
+            func("IDLE", window > busy ? window - busy : 0, uint16_t(0), uint16_t(0));
+        }
+
+        static uint32_t now() {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+    private:
+        static TaskInfo *&taskInfos() {
+            static TaskInfo *infos = nullptr;
+            return infos;
+        }
+
+        static uint32_t &lastSample() {
+            static uint32_t time = now();
+            return time;
+        }
+    };
+
+    // Models the release latency of a periodic task: releases are due every
+    // interval ms of wall time from the first one. The simulator steps in
+    // batches, so this reflects the timing of the simulator loop.
+    class ReleaseTimer {
+    public:
+        uint32_t release(uint32_t interval) {
+            uint32_t time = TaskProfiler::now();
+            uint32_t latency = time - _expected;
+            // restart after the simulation was paused
+            if (!_started || int32_t(latency) > 1000000) {
+                _started = true;
+                _expected = time + interval * 1000;
+                return 0;
+            }
+            _expected += interval * 1000;
+            return int32_t(latency) > 0 ? latency : 0;
+        }
+
+    private:
+        bool _started = false;
+        uint32_t _expected = 0;
+    };
+
     template<size_t StackSize>
     class Task {
     public:
@@ -31,9 +137,14 @@ namespace os {
     template<size_t StackSize>
     class PeriodicTask {
     public:
-        PeriodicTask(const char *name, uint8_t priority, uint32_t interval, std::function<void(void)> func) {
-            os::updateCallbacks().emplace_back(func);
+        PeriodicTask(const char *name, uint8_t priority, uint32_t interval, std::function<void(void)> func) :
+            _taskInfo(name)
+        {
+            os::updateCallbacks().emplace_back([this, func] () { TaskProfiler::run(_taskInfo, func); });
         }
+
+    private:
+        TaskProfiler::TaskInfo _taskInfo;
     };
 
     inline void suspend(TaskHandle handle) {}
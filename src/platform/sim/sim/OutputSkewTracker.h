@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Simulator.h"
+
+#include <algorithm>
+#include <array>
+
+#include <cstdint>
+
+namespace sim {
+
+// Latch model of the cv and gate outputs. The dac applies a channel when it is
+// written, the gate register applies all gates at once when it is latched, which
+// the gate output driver does by writing every channel. Each latch closes an
+// output commit. A gate opening with a new cv is compared with the commit that
+// applied the cv: a gate latched in the same commit as its cv has a skew of 0,
+// a gate latched one commit later (or latched before its cv) has a skew of at
+// least 1.
+class OutputSkewTracker : public TargetOutputHandler {
+public:
+    static constexpr int Channels = 8;
+
+    OutputSkewTracker(Simulator &simulator) :
+        _simulator(simulator)
+    {
+        _simulator.registerTargetOutputObserver(this);
+    }
+
+    ~OutputSkewTracker() {
+        _simulator.unregisterTargetOutputObserver(this);
+    }
+
+    // number of gate latches
+    int commits() const { return _commits; }
+
+    // number of gate openings with a new cv
+    int edges() const { return _edges; }
+
+    // largest skew in commits
+    int maxSkew() const { return _maxSkew; }
+
+    void writeDac(int channel, uint16_t value) override {
+        if (channel < 0 || channel >= Channels) {
+            return;
+        }
+        auto &output = _outputs[channel];
+        if (value != output.cv) {
+            output.cv = value;
+            output.cvCommit = _commits;
+            output.cvChanged = true;
+        }
+    }
+
+    void writeGateOutput(int channel, bool value) override {
+        if (channel < 0 || channel >= Channels) {
+            return;
+        }
+        auto &output = _outputs[channel];
+        if (value && !output.gate && output.cvChanged) {
+            _maxSkew = std::max(_maxSkew, _commits - output.cvCommit);
+            output.cvChanged = false;
+            ++_edges;
+        }
+        output.gate = value;
+        if (channel == Channels - 1) {
+            ++_commits;
+        }
+    }
+
+private:
+    struct Output {
+        uint16_t cv = 0;
+        int cvCommit = 0;
+        bool cvChanged = false;
+        bool gate = false;
+    };
+
+    Simulator &_simulator;
+    std::array<Output, Channels> _outputs;
+    int _commits = 0;
+    int _edges = 0;
+    int _maxSkew = 0;
+};
+
+} // namespace sim
@@ -103,6 +103,10 @@ void Simulator::registerTargetOutputObserver(TargetOutputHandler *observer) {
     _targetOutputObservers.emplace_back(observer);
 }
 
+void Simulator::unregisterTargetOutputObserver(TargetOutputHandler *observer) {
+    _targetOutputObservers.erase(std::remove(_targetOutputObservers.begin(), _targetOutputObservers.end(), observer), _targetOutputObservers.end());
+}
+
 // TargetInputHandler
 
 void Simulator::writeButton(int index, bool pressed) {
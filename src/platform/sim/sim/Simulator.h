@@ -41,6 +41,7 @@ public:
     void registerTargetTickObserver(TargetTickHandler *observer);
     void registerTargetInputObserver(TargetInputHandler *observer);
     void registerTargetOutputObserver(TargetOutputHandler *observer);
+    void unregisterTargetOutputObserver(TargetOutputHandler *observer);
 
     // TargetInputHandler
     void writeButton(int index, bool pressed) override;
@@ -35,70 +35,176 @@ struct TracePlayer : public TracePlayerBase {
 };
 
 TargetTracePlayer::TargetTracePlayer(const TargetTrace &targetTrace, TargetInputHandler *targetInputHandler, TargetOutputHandler *targetOutputHandler) :
-    _targetTrace(targetTrace),
+    _targetTrace(&targetTrace),
     _targetInputHandler(targetInputHandler),
     _targetOutputHandler(targetOutputHandler)
 {
     if (_targetInputHandler) {
-        _tracePlayers.emplace_back(new TracePlayer<ButtonTrace>(_targetTrace.button, [this] (const ButtonState &buttonState) {
-            for (size_t i = 0; i < buttonState.state.size(); ++i) {
-                _targetInputHandler->writeButton(i, buttonState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<ButtonTrace>(_targetTrace->button, [this] (const ButtonState &buttonState) {
+            playButton(buttonState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<AdcTrace>(_targetTrace.adc, [this] (const AdcState &adcState) {
-            for (size_t i = 0; i < adcState.state.size(); ++i) {
-                _targetInputHandler->writeAdc(i, adcState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<AdcTrace>(_targetTrace->adc, [this] (const AdcState &adcState) {
+            playAdc(adcState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<DigitalInputTrace>(_targetTrace.digitalInput, [this] (const DigitalInputState &digitalInputState) {
-            for (size_t i = 0; i < digitalInputState.state.size(); ++i) {
-                _targetInputHandler->writeDigitalInput(i, digitalInputState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<DigitalInputTrace>(_targetTrace->digitalInput, [this] (const DigitalInputState &digitalInputState) {
+            playDigitalInput(digitalInputState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<EncoderTrace>(_targetTrace.encoder, [this] (const EncoderEvent &encoderEvent) {
-            _targetInputHandler->writeEncoder(encoderEvent);
+        _tracePlayers.emplace_back(new TracePlayer<EncoderTrace>(_targetTrace->encoder, [this] (const EncoderEvent &encoderEvent) {
+            playEncoder(encoderEvent);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<MidiTrace>(_targetTrace.midiInput, [this] (const MidiEvent &midiEvent) {
-            _targetInputHandler->writeMidiInput(midiEvent);
+        _tracePlayers.emplace_back(new TracePlayer<MidiTrace>(_targetTrace->midiInput, [this] (const MidiEvent &midiEvent) {
+            playMidiInput(midiEvent);
         }));
     }
 
     if (_targetOutputHandler) {
-        _tracePlayers.emplace_back(new TracePlayer<LedTrace>(_targetTrace.led, [this] (const LedState &ledState) {
-            for (size_t i = 0; i < ledState.state.size() / 2; ++i) {
-                _targetOutputHandler->writeLed(i, ledState.state[i * 2], ledState.state[i * 2 + 1]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<LedTrace>(_targetTrace->led, [this] (const LedState &ledState) {
+            playLed(ledState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<GateOutputTrace>(_targetTrace.gateOutput, [this] (const GateOutputState &gateOutputState) {
-            for (size_t i = 0; i < gateOutputState.state.size(); ++i) {
-                _targetOutputHandler->writeGateOutput(i, gateOutputState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<GateOutputTrace>(_targetTrace->gateOutput, [this] (const GateOutputState &gateOutputState) {
+            playGateOutput(gateOutputState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<DacTrace>(_targetTrace.dac, [this] (const DacState &dacState) {
-            for (size_t i = 0; i < dacState.state.size(); ++i) {
-                _targetOutputHandler->writeDac(i, dacState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<DacTrace>(_targetTrace->dac, [this] (const DacState &dacState) {
+            playDac(dacState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<DigitalOutputTrace>(_targetTrace.digitalOutput, [this] (const DigitalOutputState &digitalOutputState) {
-            for (size_t i = 0; i < digitalOutputState.state.size(); ++i) {
-                _targetOutputHandler->writeDigitalOutput(i, digitalOutputState.state[i]);
-            }
+        _tracePlayers.emplace_back(new TracePlayer<DigitalOutputTrace>(_targetTrace->digitalOutput, [this] (const DigitalOutputState &digitalOutputState) {
+            playDigitalOutput(digitalOutputState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<LcdTrace>(_targetTrace.lcd, [this] (const LcdState &lcdState) {
-            _targetOutputHandler->writeLcd(lcdState.state);
+        _tracePlayers.emplace_back(new TracePlayer<LcdTrace>(_targetTrace->lcd, [this] (const LcdState &lcdState) {
+            playLcd(lcdState);
         }));
-        _tracePlayers.emplace_back(new TracePlayer<MidiTrace>(_targetTrace.midiOutput, [this] (const MidiEvent &midiEvent) {
-            _targetOutputHandler->writeMidiOutput(midiEvent);
+        _tracePlayers.emplace_back(new TracePlayer<MidiTrace>(_targetTrace->midiOutput, [this] (const MidiEvent &midiEvent) {
+            playMidiOutput(midiEvent);
         }));
     }
 }
 
+TargetTracePlayer::TargetTracePlayer(TargetTraceStreamReader &streamReader, TargetInputHandler *targetInputHandler, TargetOutputHandler *targetOutputHandler) :
+    _streamReader(&streamReader),
+    _targetInputHandler(targetInputHandler),
+    _targetOutputHandler(targetOutputHandler)
+{}
+
 TargetTracePlayer::~TargetTracePlayer() {}
 
+bool TargetTracePlayer::seek(uint32_t tick) {
+    if (!_streamReader || !_streamReader->seek(tick)) {
+        return false;
+    }
+
+    for (int channel = 0; channel < TraceChannelCount; ++channel) {
+        const uint8_t *state = _streamReader->state(TraceChannel(channel));
+        if (state) {
+            playStreamRecord(TraceChannel(channel), state);
+        }
+    }
+
+    return true;
+}
+
 void TargetTracePlayer::setTick(uint32_t tick) {
+    if (_streamReader) {
+        uint32_t nextTick;
+        TargetTraceStreamReader::Record record;
+        while (_streamReader->peekTick(nextTick) && nextTick <= tick && _streamReader->next(record)) {
+            playStreamRecord(record.channel, record.data);
+        }
+        return;
+    }
+
     for (auto &tracePlayer : _tracePlayers) {
         tracePlayer->play(tick);
     }
 }
 
+void TargetTracePlayer::playStreamRecord(TraceChannel channel, const uint8_t *data) {
+    switch (channel) {
+    case TraceChannel::Button:          playButton(*reinterpret_cast<const ButtonState *>(data)); break;
+    case TraceChannel::Adc:             playAdc(*reinterpret_cast<const AdcState *>(data)); break;
+    case TraceChannel::DigitalInput:    playDigitalInput(*reinterpret_cast<const DigitalInputState *>(data)); break;
+    case TraceChannel::Encoder:         playEncoder(*reinterpret_cast<const EncoderEvent *>(data)); break;
+    case TraceChannel::MidiInput:       playMidiInput(*reinterpret_cast<const MidiEvent *>(data)); break;
+    case TraceChannel::Led:             playLed(*reinterpret_cast<const LedState *>(data)); break;
+    case TraceChannel::GateOutput:      playGateOutput(*reinterpret_cast<const GateOutputState *>(data)); break;
+    case TraceChannel::Dac:             playDac(*reinterpret_cast<const DacState *>(data)); break;
+    case TraceChannel::DigitalOutput:   playDigitalOutput(*reinterpret_cast<const DigitalOutputState *>(data)); break;
+    case TraceChannel::Lcd:             playLcd(*reinterpret_cast<const LcdState *>(data)); break;
+    case TraceChannel::MidiOutput:      playMidiOutput(*reinterpret_cast<const MidiEvent *>(data)); break;
+    case TraceChannel::Last:            break;
+    }
+}
+
+// Inputs
+
+void TargetTracePlayer::playButton(const ButtonState &buttonState) {
+    if (!_targetInputHandler) return;
+    for (size_t i = 0; i < buttonState.state.size(); ++i) {
+        _targetInputHandler->writeButton(i, buttonState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playAdc(const AdcState &adcState) {
+    if (!_targetInputHandler) return;
+    for (size_t i = 0; i < adcState.state.size(); ++i) {
+        _targetInputHandler->writeAdc(i, adcState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playDigitalInput(const DigitalInputState &digitalInputState) {
+    if (!_targetInputHandler) return;
+    for (size_t i = 0; i < digitalInputState.state.size(); ++i) {
+        _targetInputHandler->writeDigitalInput(i, digitalInputState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playEncoder(const EncoderEvent &encoderEvent) {
+    if (!_targetInputHandler) return;
+    _targetInputHandler->writeEncoder(encoderEvent);
+}
+
+void TargetTracePlayer::playMidiInput(const MidiEvent &midiEvent) {
+    if (!_targetInputHandler) return;
+    _targetInputHandler->writeMidiInput(midiEvent);
+}
+
+// Outputs
+
+void TargetTracePlayer::playLed(const LedState &ledState) {
+    if (!_targetOutputHandler) return;
+    for (size_t i = 0; i < ledState.state.size() / 2; ++i) {
+        _targetOutputHandler->writeLed(i, ledState.state[i * 2], ledState.state[i * 2 + 1]);
+    }
+}
+
+void TargetTracePlayer::playGateOutput(const GateOutputState &gateOutputState) {
+    if (!_targetOutputHandler) return;
+    for (size_t i = 0; i < gateOutputState.state.size(); ++i) {
+        _targetOutputHandler->writeGateOutput(i, gateOutputState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playDac(const DacState &dacState) {
+    if (!_targetOutputHandler) return;
+    for (size_t i = 0; i < dacState.state.size(); ++i) {
+        _targetOutputHandler->writeDac(i, dacState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playDigitalOutput(const DigitalOutputState &digitalOutputState) {
+    if (!_targetOutputHandler) return;
+    for (size_t i = 0; i < digitalOutputState.state.size(); ++i) {
+        _targetOutputHandler->writeDigitalOutput(i, digitalOutputState.state[i]);
+    }
+}
+
+void TargetTracePlayer::playLcd(const LcdState &lcdState) {
+    if (!_targetOutputHandler) return;
+    _targetOutputHandler->writeLcd(lcdState.state);
+}
+
+void TargetTracePlayer::playMidiOutput(const MidiEvent &midiEvent) {
+    if (!_targetOutputHandler) return;
+    _targetOutputHandler->writeMidiOutput(midiEvent);
+}
+
 } // namespace sim
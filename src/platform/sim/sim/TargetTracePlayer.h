@@ -2,6 +2,7 @@
 
 #include "Target.h"
 #include "TargetTrace.h"
+#include "TargetTraceStream.h"
 
 #include <vector>
 #include <memory>
@@ -15,14 +16,34 @@ struct TracePlayerBase;
 class TargetTracePlayer : public TargetTickHandler {
 public:
     TargetTracePlayer(const TargetTrace &targetTrace, TargetInputHandler *targetInputHandler, TargetOutputHandler *targetOutputHandler);
+    // plays back a stream trace, reading chunks on demand
+    TargetTracePlayer(TargetTraceStreamReader &streamReader, TargetInputHandler *targetInputHandler, TargetOutputHandler *targetOutputHandler);
     ~TargetTracePlayer();
 
-    const TargetTrace &targetTrace() const { return _targetTrace; }
+    const TargetTrace &targetTrace() const { return *_targetTrace; }
+
+    // jump to the given tick and replay the current state of all channels (stream traces only)
+    bool seek(uint32_t tick);
 
 protected:
     virtual void setTick(uint32_t tick) override;
 
-    const TargetTrace &_targetTrace;
+    void playStreamRecord(TraceChannel channel, const uint8_t *data);
+
+    void playButton(const ButtonState &buttonState);
+    void playAdc(const AdcState &adcState);
+    void playDigitalInput(const DigitalInputState &digitalInputState);
+    void playEncoder(const EncoderEvent &encoderEvent);
+    void playMidiInput(const MidiEvent &midiEvent);
+    void playLed(const LedState &ledState);
+    void playGateOutput(const GateOutputState &gateOutputState);
+    void playDac(const DacState &dacState);
+    void playDigitalOutput(const DigitalOutputState &digitalOutputState);
+    void playLcd(const LcdState &lcdState);
+    void playMidiOutput(const MidiEvent &midiEvent);
+
+    const TargetTrace *_targetTrace = nullptr;
+    TargetTraceStreamReader *_streamReader = nullptr;
     TargetInputHandler *_targetInputHandler;
     TargetOutputHandler *_targetOutputHandler;
 
@@ -4,7 +4,12 @@ namespace sim {
 
 TargetTraceRecorder::TargetTraceRecorder(TargetTrace &targetTrace) :
     TargetStateTracker(_targetState),
-    _targetTrace(targetTrace)
+    _targetTrace(&targetTrace)
+{}
+
+TargetTraceRecorder::TargetTraceRecorder(TargetTraceStreamWriter &streamWriter) :
+    TargetStateTracker(_targetState),
+    _streamWriter(&streamWriter)
 {}
 
 // TargetTickHandler
@@ -17,56 +22,100 @@ void TargetTraceRecorder::setTick(uint32_t tick) {
 
 void TargetTraceRecorder::writeButton(int index, bool pressed) {
     TargetStateTracker::writeButton(index, pressed);
-    _targetTrace.button.write(_tick, _targetState.button);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::Button, _tick, _targetState.button);
+    } else {
+        _targetTrace->button.write(_tick, _targetState.button);
+    }
 }
 
 void TargetTraceRecorder::writeEncoder(EncoderEvent event) {
-    _targetTrace.encoder.write(_tick, event);
+    if (_streamWriter) {
+        _streamWriter->writeEvent(TraceChannel::Encoder, _tick, event);
+    } else {
+        _targetTrace->encoder.write(_tick, event);
+    }
 }
 
 void TargetTraceRecorder::writeAdc(int channel, uint16_t value) {
     TargetStateTracker::writeAdc(channel, value);
-    _targetTrace.adc.write(_tick, _targetState.adc);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::Adc, _tick, _targetState.adc);
+    } else {
+        _targetTrace->adc.write(_tick, _targetState.adc);
+    }
 }
 
 void TargetTraceRecorder::writeDigitalInput(int pin, bool value) {
     TargetStateTracker::writeDigitalInput(pin, value);
-    _targetTrace.digitalInput.write(_tick, _targetState.digitalInput);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::DigitalInput, _tick, _targetState.digitalInput);
+    } else {
+        _targetTrace->digitalInput.write(_tick, _targetState.digitalInput);
+    }
 }
 
 void TargetTraceRecorder::writeMidiInput(MidiEvent event) {
-    _targetTrace.midiInput.write(_tick, event);
+    if (_streamWriter) {
+        _streamWriter->writeEvent(TraceChannel::MidiInput, _tick, event);
+    } else {
+        _targetTrace->midiInput.write(_tick, event);
+    }
 }
 
 // TargetOutputHandler
 
 void TargetTraceRecorder::writeLed(int index, bool red, bool green) {
     TargetStateTracker::writeLed(index, red, green);
-    _targetTrace.led.write(_tick, _targetState.led);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::Led, _tick, _targetState.led);
+    } else {
+        _targetTrace->led.write(_tick, _targetState.led);
+    }
 }
 
 void TargetTraceRecorder::writeGateOutput(int channel, bool value) {
     TargetStateTracker::writeGateOutput(channel, value);
-    _targetTrace.gateOutput.write(_tick, _targetState.gateOutput);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::GateOutput, _tick, _targetState.gateOutput);
+    } else {
+        _targetTrace->gateOutput.write(_tick, _targetState.gateOutput);
+    }
 }
 
 void TargetTraceRecorder::writeDac(int channel, uint16_t value) {
     TargetStateTracker::writeDac(channel, value);
-    _targetTrace.dac.write(_tick, _targetState.dac);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::Dac, _tick, _targetState.dac);
+    } else {
+        _targetTrace->dac.write(_tick, _targetState.dac);
+    }
 }
 
 void TargetTraceRecorder::writeDigitalOutput(int pin, bool value) {
     TargetStateTracker::writeDigitalOutput(pin, value);
-    _targetTrace.digitalOutput.write(_tick, _targetState.digitalOutput);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::DigitalOutput, _tick, _targetState.digitalOutput);
+    } else {
+        _targetTrace->digitalOutput.write(_tick, _targetState.digitalOutput);
+    }
 }
 
 void TargetTraceRecorder::writeLcd(const FrameBuffer &frameBuffer) {
     TargetStateTracker::writeLcd(frameBuffer);
-    _targetTrace.lcd.write(_tick, _targetState.lcd);
+    if (_streamWriter) {
+        _streamWriter->writeState(TraceChannel::Lcd, _tick, _targetState.lcd);
+    } else {
+        _targetTrace->lcd.write(_tick, _targetState.lcd);
+    }
 }
 
 void TargetTraceRecorder::writeMidiOutput(MidiEvent event) {
-    _targetTrace.midiOutput.write(_tick, event);
+    if (_streamWriter) {
+        _streamWriter->writeEvent(TraceChannel::MidiOutput, _tick, event);
+    } else {
+        _targetTrace->midiOutput.write(_tick, event);
+    }
 }
 
 } // namespace sim
@@ -2,14 +2,18 @@
 
 #include "TargetStateTracker.h"
 #include "TargetTrace.h"
+#include "TargetTraceStream.h"
 
 namespace sim {
 
 class TargetTraceRecorder : public TargetStateTracker, public TargetTickHandler {
 public:
+    // record into an in-memory trace
     TargetTraceRecorder(TargetTrace &targetTrace);
+    // record incrementally into a stream, for long sessions
+    TargetTraceRecorder(TargetTraceStreamWriter &streamWriter);
 
-    TargetTrace &targetTrace() { return _targetTrace; }
+    TargetTrace &targetTrace() { return *_targetTrace; }
 
     // TargetTickHandler
     virtual void setTick(uint32_t tick) override;
@@ -32,7 +36,8 @@ public:
 private:
     TargetState _targetState;
     uint32_t _tick = 0;
-    TargetTrace &_targetTrace;
+    TargetTrace *_targetTrace = nullptr;
+    TargetTraceStreamWriter *_streamWriter = nullptr;
 };
 
 } // namespace sim
@@ -0,0 +1,558 @@
+#include "TargetTraceStream.h"
+
+#include <algorithm>
+
+#include <cstring>
+
+namespace sim {
+
+// ----------------------------------------------------------------------------
+// Encoding helpers
+// ----------------------------------------------------------------------------
+
+template<typename T>
+static void writeRaw(std::ostream &stream, T data) {
+    stream.write(reinterpret_cast<const char *>(&data), sizeof(T));
+}
+
+template<typename T>
+static bool readRaw(std::istream &stream, T &data) {
+    stream.read(reinterpret_cast<char *>(&data), sizeof(T));
+    return bool(stream);
+}
+
+static void writeVarint(std::vector<uint8_t> &buffer, uint32_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    buffer.push_back(uint8_t(value));
+}
+
+static bool readVarint(const std::vector<uint8_t> &buffer, size_t &pos, uint32_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (pos >= buffer.size()) {
+            return false;
+        }
+        uint8_t byte = buffer[pos++];
+        value |= uint32_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Encodes cur XOR prev (prev == nullptr encodes cur against zero) as groups of
+// (zero run, literal count, literal bytes). Zero runs shorter than 3 bytes are
+// folded into the literal to avoid group overhead.
+static void encodeDelta(std::vector<uint8_t> &buffer, const uint8_t *prev, const uint8_t *cur, size_t size) {
+    auto diff = [prev, cur] (size_t i) -> uint8_t { return prev ? (prev[i] ^ cur[i]) : cur[i]; };
+
+    size_t i = 0;
+    while (i < size) {
+        size_t zeros = 0;
+        while (i + zeros < size && diff(i + zeros) == 0) {
+            ++zeros;
+        }
+        i += zeros;
+
+        size_t literal = 0;
+        while (i + literal < size) {
+            if (diff(i + literal) != 0) {
+                ++literal;
+                continue;
+            }
+            size_t run = 0;
+            while (i + literal + run < size && diff(i + literal + run) == 0) {
+                ++run;
+            }
+            if (run >= 3 || i + literal + run == size) {
+                break;
+            }
+            literal += run;
+        }
+
+        writeVarint(buffer, zeros);
+        writeVarint(buffer, literal);
+        for (size_t j = 0; j < literal; ++j) {
+            buffer.push_back(diff(i + j));
+        }
+        i += literal;
+    }
+}
+
+static bool decodeDelta(const std::vector<uint8_t> &buffer, size_t &pos, uint8_t *state, size_t size) {
+    size_t i = 0;
+    while (i < size) {
+        uint32_t zeros, literal;
+        if (!readVarint(buffer, pos, zeros) || !readVarint(buffer, pos, literal)) {
+            return false;
+        }
+        if (zeros + literal == 0 || i + zeros + literal > size || pos + literal > buffer.size()) {
+            return false;
+        }
+        i += zeros;
+        for (size_t j = 0; j < literal; ++j) {
+            state[i++] ^= buffer[pos++];
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// TraceStream
+// ----------------------------------------------------------------------------
+
+bool TraceStream::isStateChannel(TraceChannel channel) {
+    switch (channel) {
+    case TraceChannel::Encoder:
+    case TraceChannel::MidiInput:
+    case TraceChannel::MidiOutput:
+        return false;
+    default:
+        return true;
+    }
+}
+
+size_t TraceStream::channelSize(TraceChannel channel) {
+    switch (channel) {
+    case TraceChannel::Button:          return sizeof(ButtonState);
+    case TraceChannel::Adc:             return sizeof(AdcState);
+    case TraceChannel::DigitalInput:    return sizeof(DigitalInputState);
+    case TraceChannel::Led:             return sizeof(LedState);
+    case TraceChannel::GateOutput:      return sizeof(GateOutputState);
+    case TraceChannel::Dac:             return sizeof(DacState);
+    case TraceChannel::DigitalOutput:   return sizeof(DigitalOutputState);
+    case TraceChannel::Lcd:             return sizeof(LcdState);
+    case TraceChannel::Encoder:         return sizeof(EncoderEvent);
+    case TraceChannel::MidiInput:       return sizeof(MidiEvent);
+    case TraceChannel::MidiOutput:      return sizeof(MidiEvent);
+    case TraceChannel::Last:            break;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// TargetTraceStreamWriter
+// ----------------------------------------------------------------------------
+
+TargetTraceStreamWriter::~TargetTraceStreamWriter() {
+    close();
+}
+
+bool TargetTraceStreamWriter::open(const std::string &filename, size_t chunkSize) {
+    close();
+
+    _ofs.open(filename, std::ios::binary | std::ios::trunc);
+    if (!_ofs) {
+        return false;
+    }
+
+    _chunkSize = std::max(chunkSize, size_t(1024));
+    _chunk.clear();
+    _chunk.reserve(_chunkSize + sizeof(LcdState) * 2);
+    _chunkOpen = false;
+    _pendingTick = 0;
+    _index.clear();
+    for (auto &channel : _channels) {
+        channel = ChannelState();
+    }
+
+    writeRaw(_ofs, TraceStream::FileMagic);
+    writeRaw(_ofs, TraceStream::Version);
+
+    return bool(_ofs);
+}
+
+void TargetTraceStreamWriter::close() {
+    if (!_ofs.is_open()) {
+        return;
+    }
+
+    flush();
+
+    uint64_t indexOffset = uint64_t(_ofs.tellp());
+    writeRaw(_ofs, uint32_t(_index.size()));
+    for (const auto &entry : _index) {
+        writeRaw(_ofs, entry.tick);
+        writeRaw(_ofs, entry.offset);
+    }
+    writeRaw(_ofs, indexOffset);
+    writeRaw(_ofs, TraceStream::IndexMagic);
+
+    _ofs.close();
+}
+
+void TargetTraceStreamWriter::flush() {
+    if (!_ofs.is_open()) {
+        return;
+    }
+
+    flushPending();
+    endChunk();
+    _ofs.flush();
+}
+
+void TargetTraceStreamWriter::writeState(TraceChannel channel, uint32_t tick, const uint8_t *data, size_t size) {
+    if (!_ofs.is_open() || size != TraceStream::channelSize(channel)) {
+        return;
+    }
+
+    if (tick != _pendingTick) {
+        flushPending();
+        _pendingTick = tick;
+    }
+
+    auto &state = _channels[int(channel)];
+    state.pending.assign(data, data + size);
+    state.dirty = true;
+}
+
+void TargetTraceStreamWriter::writeEvent(TraceChannel channel, uint32_t tick, const uint8_t *data, size_t size) {
+    if (!_ofs.is_open() || size != TraceStream::channelSize(channel)) {
+        return;
+    }
+
+    if (tick != _pendingTick) {
+        flushPending();
+        _pendingTick = tick;
+    }
+
+    if (!_chunkOpen) {
+        beginChunk(tick);
+    }
+    beginRecord(int(channel), tick);
+    _chunk.insert(_chunk.end(), data, data + size);
+
+    if (_chunk.size() >= _chunkSize) {
+        endChunk();
+    }
+}
+
+void TargetTraceStreamWriter::flushPending() {
+    for (int channel = 0; channel < TraceChannelCount; ++channel) {
+        auto &state = _channels[channel];
+        if (!state.dirty) {
+            continue;
+        }
+        state.dirty = false;
+        if (state.known && state.pending == state.emitted) {
+            continue;
+        }
+        emitState(channel, _pendingTick, false);
+        if (_chunk.size() >= _chunkSize) {
+            endChunk();
+        }
+    }
+}
+
+void TargetTraceStreamWriter::emitState(int channel, uint32_t tick, bool keyframe) {
+    auto &state = _channels[channel];
+
+    if (!keyframe && !_chunkOpen) {
+        beginChunk(tick);
+    }
+
+    beginRecord(channel, tick);
+    if (keyframe) {
+        encodeDelta(_chunk, nullptr, state.emitted.data(), state.emitted.size());
+    } else {
+        encodeDelta(_chunk, state.known ? state.emitted.data() : nullptr, state.pending.data(), state.pending.size());
+        state.emitted = state.pending;
+        state.known = true;
+    }
+}
+
+void TargetTraceStreamWriter::beginRecord(int channel, uint32_t tick) {
+    _chunk.push_back(uint8_t(channel));
+    writeVarint(_chunk, tick - _lastTick);
+    _lastTick = tick;
+    ++_chunkRecords;
+}
+
+void TargetTraceStreamWriter::beginChunk(uint32_t tick) {
+    _chunk.clear();
+    _chunkOpen = true;
+    _chunkTick = tick;
+    _chunkRecords = 0;
+    _lastTick = tick;
+
+    for (int channel = 0; channel < TraceChannelCount; ++channel) {
+        if (_channels[channel].known) {
+            emitState(channel, tick, true);
+        }
+    }
+}
+
+void TargetTraceStreamWriter::endChunk() {
+    if (!_chunkOpen) {
+        return;
+    }
+
+    _index.push_back({ _chunkTick, uint64_t(_ofs.tellp()) });
+
+    writeRaw(_ofs, TraceStream::ChunkMagic);
+    writeRaw(_ofs, _chunkTick);
+    writeRaw(_ofs, _chunkRecords);
+    writeRaw(_ofs, uint32_t(_chunk.size()));
+    _ofs.write(reinterpret_cast<const char *>(_chunk.data()), _chunk.size());
+
+    _chunk.clear();
+    _chunkOpen = false;
+}
+
+// ----------------------------------------------------------------------------
+// TargetTraceStreamReader
+// ----------------------------------------------------------------------------
+
+bool TargetTraceStreamReader::open(const std::string &filename) {
+    close();
+
+    _ifs.open(filename, std::ios::binary);
+    if (!_ifs) {
+        return false;
+    }
+
+    uint32_t magic, version;
+    if (!readRaw(_ifs, magic) || !readRaw(_ifs, version) || magic != TraceStream::FileMagic || version != TraceStream::Version) {
+        _ifs.close();
+        return false;
+    }
+
+    // recordings that were not closed properly have no index, rebuild it from the chunk headers
+    if (!readIndex()) {
+        scanChunks();
+    }
+
+    resetStates();
+    loadChunk(0);
+
+    return true;
+}
+
+void TargetTraceStreamReader::close() {
+    if (_ifs.is_open()) {
+        _ifs.close();
+    }
+    _index.clear();
+    _chunk.clear();
+    _chunkIndex = 0;
+    _pos = 0;
+    _recordsLeft = 0;
+}
+
+bool TargetTraceStreamReader::readIndex() {
+    const std::streamoff footerSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+    _ifs.clear();
+    _ifs.seekg(0, std::ios::end);
+    std::streamoff fileSize = _ifs.tellg();
+    if (fileSize < std::streamoff(2 * sizeof(uint32_t)) + footerSize) {
+        return false;
+    }
+
+    uint64_t indexOffset;
+    uint32_t magic, count;
+    _ifs.seekg(fileSize - footerSize);
+    if (!readRaw(_ifs, indexOffset) || !readRaw(_ifs, magic) || magic != TraceStream::IndexMagic) {
+        return false;
+    }
+    if (indexOffset >= uint64_t(fileSize - footerSize)) {
+        return false;
+    }
+
+    _ifs.seekg(indexOffset);
+    if (!readRaw(_ifs, count)) {
+        return false;
+    }
+    _index.resize(count);
+    for (auto &entry : _index) {
+        if (!readRaw(_ifs, entry.tick) || !readRaw(_ifs, entry.offset)) {
+            _index.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TargetTraceStreamReader::scanChunks() {
+    _index.clear();
+
+    _ifs.clear();
+    _ifs.seekg(2 * sizeof(uint32_t));
+
+    while (true) {
+        uint64_t offset = uint64_t(_ifs.tellg());
+        uint32_t magic, tick, records, size;
+        if (!readRaw(_ifs, magic) || magic != TraceStream::ChunkMagic ||
+            !readRaw(_ifs, tick) || !readRaw(_ifs, records) || !readRaw(_ifs, size)) {
+            break;
+        }
+        _ifs.seekg(size, std::ios::cur);
+        if (!_ifs) {
+            break;
+        }
+        _index.push_back({ tick, offset });
+    }
+
+    _ifs.clear();
+}
+
+bool TargetTraceStreamReader::loadChunk(size_t index) {
+    if (index >= _index.size()) {
+        _recordsLeft = 0;
+        return false;
+    }
+
+    uint32_t magic, tick, records, size;
+    _ifs.clear();
+    _ifs.seekg(_index[index].offset);
+    if (!readRaw(_ifs, magic) || magic != TraceStream::ChunkMagic ||
+        !readRaw(_ifs, tick) || !readRaw(_ifs, records) || !readRaw(_ifs, size)) {
+        _recordsLeft = 0;
+        return false;
+    }
+
+    _chunk.resize(size);
+    _ifs.read(reinterpret_cast<char *>(_chunk.data()), size);
+    if (!_ifs) {
+        _recordsLeft = 0;
+        return false;
+    }
+
+    _chunkIndex = index;
+    _pos = 0;
+    _recordsLeft = records;
+    _tick = tick;
+
+    // the first record of each state channel in a chunk is encoded against zero
+    _chunkSeen.fill(false);
+
+    return true;
+}
+
+void TargetTraceStreamReader::resetStates() {
+    for (int channel = 0; channel < TraceChannelCount; ++channel) {
+        auto &state = _states[channel];
+        state.assign(TraceStream::isStateChannel(TraceChannel(channel)) ? TraceStream::channelSize(TraceChannel(channel)) : 0, 0);
+        _known[channel] = false;
+    }
+}
+
+bool TargetTraceStreamReader::ensureRecord() {
+    while (_recordsLeft == 0) {
+        if (!loadChunk(_chunkIndex + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TargetTraceStreamReader::readRecordHeader(size_t &pos, int &channel, uint32_t &tick) const {
+    if (pos >= _chunk.size()) {
+        return false;
+    }
+    channel = _chunk[pos++];
+    if (channel >= TraceChannelCount) {
+        return false;
+    }
+    uint32_t delta;
+    if (!readVarint(_chunk, pos, delta)) {
+        return false;
+    }
+    tick = _tick + delta;
+    return true;
+}
+
+bool TargetTraceStreamReader::seek(uint32_t tick) {
+    if (!_ifs.is_open()) {
+        return false;
+    }
+
+    auto it = std::upper_bound(_index.begin(), _index.end(), tick, [] (uint32_t tick, const IndexEntry &entry) {
+        return tick < entry.tick;
+    });
+    size_t index = it == _index.begin() ? 0 : size_t(it - _index.begin()) - 1;
+    resetStates();
+    if (!loadChunk(index)) {
+        return false;
+    }
+
+    uint32_t nextTick;
+    Record record;
+    while (peekTick(nextTick) && nextTick < tick) {
+        next(record);
+    }
+
+    return true;
+}
+
+bool TargetTraceStreamReader::peekTick(uint32_t &tick) {
+    if (!ensureRecord()) {
+        return false;
+    }
+    size_t pos = _pos;
+    int channel;
+    return readRecordHeader(pos, channel, tick);
+}
+
+bool TargetTraceStreamReader::next(Record &record) {
+    if (!ensureRecord()) {
+        return false;
+    }
+
+    int channel;
+    uint32_t tick;
+    if (!readRecordHeader(_pos, channel, tick)) {
+        _recordsLeft = 0;
+        return false;
+    }
+
+    TraceChannel traceChannel = TraceChannel(channel);
+    size_t size = TraceStream::channelSize(traceChannel);
+
+    if (TraceStream::isStateChannel(traceChannel)) {
+        auto &state = _states[channel];
+        if (!_chunkSeen[channel]) {
+            std::fill(state.begin(), state.end(), 0);
+            _chunkSeen[channel] = true;
+        }
+        if (!decodeDelta(_chunk, _pos, state.data(), size)) {
+            _recordsLeft = 0;
+            return false;
+        }
+        _known[channel] = true;
+        record.data = state.data();
+    } else {
+        if (_pos + size > _chunk.size()) {
+            _recordsLeft = 0;
+            return false;
+        }
+        // copy into an aligned buffer, records are packed in the chunk
+        _event.assign(_chunk.begin() + _pos, _chunk.begin() + _pos + size);
+        _pos += size;
+        record.data = _event.data();
+    }
+
+    _tick = tick;
+    --_recordsLeft;
+
+    record.channel = traceChannel;
+    record.tick = tick;
+    record.size = size;
+
+    return true;
+}
+
+const uint8_t *TargetTraceStreamReader::state(TraceChannel channel) const {
+    int index = int(channel);
+    if (index >= TraceChannelCount || !_known[index]) {
+        return nullptr;
+    }
+    return _states[index].data();
+}
+
+} // namespace sim
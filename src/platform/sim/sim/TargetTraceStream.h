@@ -0,0 +1,201 @@
+#pragma once
+
+#include "TargetState.h"
+#include "EncoderEvent.h"
+#include "MidiEvent.h"
+
+#include <array>
+#include <vector>
+#include <string>
+#include <fstream>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace sim {
+
+// Chunked trace format for long recordings.
+//
+// Unlike TargetTrace, which keeps every record in memory and serializes at
+// the end, the stream format is written incrementally while recording and
+// read back chunk by chunk during playback.
+//
+// File layout:
+//   header:  magic, version
+//   chunks:  magic, start tick, record count, payload size, payload
+//   index:   chunk count, (start tick, file offset) per chunk
+//   footer:  index offset, magic
+//
+// Each record is a channel byte, a varint tick delta (relative to the
+// previous record in the chunk) and a payload. State payloads are the XOR
+// delta against the previous state of the same channel, run-length encoded
+// as (zero run, literal count, literal bytes) varint groups. Event payloads
+// are stored raw. Every chunk starts with keyframes of all known states, so
+// chunks decode independently and the index can be used for seeking.
+
+enum class TraceChannel : uint8_t {
+    Button,
+    Adc,
+    DigitalInput,
+    Led,
+    GateOutput,
+    Dac,
+    DigitalOutput,
+    Lcd,
+    Encoder,
+    MidiInput,
+    MidiOutput,
+    Last
+};
+
+static constexpr int TraceChannelCount = int(TraceChannel::Last);
+
+namespace TraceStream {
+
+    static constexpr uint32_t FileMagic = 0x43525450;   // 'PTRC'
+    static constexpr uint32_t ChunkMagic = 0x4b4e4843;  // 'CHNK'
+    static constexpr uint32_t IndexMagic = 0x58444e49;  // 'INDX'
+    static constexpr uint32_t Version = 1;
+
+    static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+    bool isStateChannel(TraceChannel channel);
+    size_t channelSize(TraceChannel channel);
+
+} // namespace TraceStream
+
+class TargetTraceStreamWriter {
+public:
+    TargetTraceStreamWriter() = default;
+    ~TargetTraceStreamWriter();
+
+    TargetTraceStreamWriter(const TargetTraceStreamWriter &) = delete;
+    TargetTraceStreamWriter &operator=(const TargetTraceStreamWriter &) = delete;
+
+    bool open(const std::string &filename, size_t chunkSize = TraceStream::DefaultChunkSize);
+    void close();
+
+    bool isOpen() const { return _ofs.is_open(); }
+
+    // number of chunks written so far
+    size_t chunkCount() const { return _index.size(); }
+
+    // state records written on the same tick collapse into one, unchanged states are dropped
+    template<typename T>
+    void writeState(TraceChannel channel, uint32_t tick, const T &state) {
+        writeState(channel, tick, reinterpret_cast<const uint8_t *>(&state), sizeof(T));
+    }
+
+    template<typename T>
+    void writeEvent(TraceChannel channel, uint32_t tick, const T &event) {
+        writeEvent(channel, tick, reinterpret_cast<const uint8_t *>(&event), sizeof(T));
+    }
+
+    // flush pending states and the current chunk to disk
+    void flush();
+
+private:
+    struct ChannelState {
+        std::vector<uint8_t> pending;
+        std::vector<uint8_t> emitted;
+        bool dirty = false;
+        bool known = false;
+    };
+
+    struct IndexEntry {
+        uint32_t tick;
+        uint64_t offset;
+    };
+
+    void writeState(TraceChannel channel, uint32_t tick, const uint8_t *data, size_t size);
+    void writeEvent(TraceChannel channel, uint32_t tick, const uint8_t *data, size_t size);
+
+    void flushPending();
+    void emitState(int channel, uint32_t tick, bool keyframe);
+    void beginRecord(int channel, uint32_t tick);
+    void beginChunk(uint32_t tick);
+    void endChunk();
+
+    std::ofstream _ofs;
+    size_t _chunkSize = TraceStream::DefaultChunkSize;
+
+    std::vector<uint8_t> _chunk;
+    bool _chunkOpen = false;
+    uint32_t _chunkTick = 0;
+    uint32_t _chunkRecords = 0;
+    uint32_t _lastTick = 0;
+
+    uint32_t _pendingTick = 0;
+    std::array<ChannelState, TraceChannelCount> _channels;
+    std::vector<IndexEntry> _index;
+};
+
+class TargetTraceStreamReader {
+public:
+    struct Record {
+        TraceChannel channel;
+        uint32_t tick;
+        const uint8_t *data;
+        size_t size;
+
+        template<typename T>
+        const T &as() const { return *reinterpret_cast<const T *>(data); }
+    };
+
+    TargetTraceStreamReader() = default;
+
+    TargetTraceStreamReader(const TargetTraceStreamReader &) = delete;
+    TargetTraceStreamReader &operator=(const TargetTraceStreamReader &) = delete;
+
+    bool open(const std::string &filename);
+    void close();
+
+    bool isOpen() const { return _ifs.is_open(); }
+
+    size_t chunkCount() const { return _index.size(); }
+
+    // position the reader at the first record with a tick >= the given tick,
+    // state channels reflect the state just before that record
+    bool seek(uint32_t tick);
+
+    // tick of the next record without consuming it, false at the end of the trace
+    bool peekTick(uint32_t &tick);
+
+    // read the next record, state records point to the fully reconstructed state
+    bool next(Record &record);
+
+    // current reconstructed state of a state channel (nullptr if not seen yet)
+    const uint8_t *state(TraceChannel channel) const;
+
+    template<typename T>
+    const T *stateAs(TraceChannel channel) const { return reinterpret_cast<const T *>(state(channel)); }
+
+private:
+    struct IndexEntry {
+        uint32_t tick;
+        uint64_t offset;
+    };
+
+    bool readIndex();
+    void scanChunks();
+    bool loadChunk(size_t index);
+    void resetStates();
+    bool ensureRecord();
+    bool readRecordHeader(size_t &pos, int &channel, uint32_t &tick) const;
+
+    std::ifstream _ifs;
+    std::vector<IndexEntry> _index;
+
+    size_t _chunkIndex = 0;
+    std::vector<uint8_t> _chunk;
+    size_t _pos = 0;
+    uint32_t _recordsLeft = 0;
+    uint32_t _tick = 0;
+
+    std::array<std::vector<uint8_t>, TraceChannelCount> _states;
+    std::array<bool, TraceChannelCount> _known {};
+    std::array<bool, TraceChannelCount> _chunkSeen {};
+    std::vector<uint8_t> _event;
+};
+
+} // namespace sim
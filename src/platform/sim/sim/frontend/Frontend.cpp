@@ -26,6 +26,9 @@
 
 namespace sim {
 
+// incoming SysEx is passed on as MidiMessage payload, keep it within a payload pool slot
+static constexpr size_t MaxSysExLength = 16;
+
 #ifdef __EMSCRIPTEN__
 static Frontend *g_instance;
 #endif
@@ -54,6 +57,8 @@ int Frontend::main(int argc, char *argv[]) {
     args::ArgumentParser parser("PER|FORMER Simulator", "");
     args::HelpFlag help(parser, "help", "Display this help menu", { 'h', "help" });
     args::Flag showMidiPorts(parser, "midi", "Show available MIDI ports", { 'm', "midi" });
+    args::ValueFlag<std::string> recordTrace(parser, "file", "Record a stream trace of the session", { 'r', "record" });
+    args::ValueFlag<std::string> playTrace(parser, "file", "Play back inputs from a stream trace", { 'p', "play" });
 
     try {
         parser.ParseCLI(argc, argv);
@@ -71,7 +76,15 @@ int Frontend::main(int argc, char *argv[]) {
         return 0;
     }
 
+    if (recordTrace && !setupTraceRecording(args::get(recordTrace))) {
+        std::cerr << "Failed to open trace file for recording: " << args::get(recordTrace) << std::endl;
+        return 1;
+    }
 
+    if (playTrace && !setupTracePlayback(args::get(playTrace))) {
+        std::cerr << "Failed to open trace file for playback: " << args::get(playTrace) << std::endl;
+        return 1;
+    }
 
     run();
 
@@ -133,6 +146,26 @@ void Frontend::render() {
     _window->render();
 }
 
+bool Frontend::setupTraceRecording(const std::string &filename) {
+    if (!_traceWriter.open(filename)) {
+        return false;
+    }
+    _traceRecorder.reset(new TargetTraceRecorder(_traceWriter));
+    _simulator.registerTargetTickObserver(_traceRecorder.get());
+    _simulator.registerTargetInputObserver(_traceRecorder.get());
+    _simulator.registerTargetOutputObserver(_traceRecorder.get());
+    return true;
+}
+
+bool Frontend::setupTracePlayback(const std::string &filename) {
+    if (!_traceReader.open(filename)) {
+        return false;
+    }
+    _tracePlayer.reset(new TargetTracePlayer(_traceReader, &_simulator, nullptr));
+    _simulator.registerTargetTickObserver(_tracePlayer.get());
+    return true;
+}
+
 void Frontend::delay(int ms) {
     SDL_Delay(ms);
 }
@@ -387,7 +420,9 @@ void Frontend::setupMidi() {
         usbMidiPortConfig.portIn,
         usbMidiPortConfig.portOut,
         [this] (const std::vector<uint8_t> &message) {
-            if (message.size() >= 1 && message.size() <= 3) {
+            if (message.size() >= 2 && message.size() <= 2 + MaxSysExLength && message.front() == 0xf0 && message.back() == 0xf7) {
+                _simulator.writeMidiInput(MidiEvent::makeMessage(1, MidiMessage::makeSystemExclusive(message.data() + 1, message.size() - 2)));
+            } else if (message.size() >= 1 && message.size() <= 3) {
                 _simulator.writeMidiInput(MidiEvent::makeMessage(1, MidiMessage(message.data(), message.size())));
             }
         },
@@ -16,6 +16,9 @@
 #include "widgets/Jack.h"
 
 #include "sim/Simulator.h"
+#include "sim/TargetTracePlayer.h"
+#include "sim/TargetTraceRecorder.h"
+#include "sim/TargetTraceStream.h"
 
 #include <string>
 #include <vector>
@@ -52,6 +55,9 @@ private:
     void setupMidi();
     void setupInstruments();
 
+    bool setupTraceRecording(const std::string &filename);
+    bool setupTracePlayback(const std::string &filename);
+
     // TargetInputHandler
     void writeButton(int index, bool pressed) override;
     void writeEncoder(EncoderEvent event) override;
@@ -83,6 +89,11 @@ private:
 
     std::unique_ptr<ClockSource> _clockSource;
 
+    TargetTraceStreamWriter _traceWriter;
+    std::unique_ptr<TargetTraceRecorder> _traceRecorder;
+    TargetTraceStreamReader _traceReader;
+    std::unique_ptr<TargetTracePlayer> _tracePlayer;
+
     Window::Ptr _window;
     Encoder::Ptr _encoder;
     Display::Ptr _lcd;
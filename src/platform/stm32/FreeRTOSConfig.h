@@ -40,7 +40,7 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
 
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                     0
-#define configUSE_TICK_HOOK                     0
+#define configUSE_TICK_HOOK                     CONFIG_ENABLE_TASK_PROFILER
 #define configCHECK_FOR_STACK_OVERFLOW          CONFIG_ENABLE_DEBUG
 #define configUSE_MALLOC_FAILED_HOOK            0
 
@@ -98,9 +98,10 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
 
 
 #if configGENERATE_RUN_TIME_STATS
-extern uint32_t highResolutionTimerTicks();
-#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() ( {} )
-#define portGET_RUN_TIME_COUNTER_VALUE() highResolutionTimerTicks()
+extern void runTimeCounterInit();
+extern uint32_t runTimeCounterValue();
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() runTimeCounterInit()
+#define portGET_RUN_TIME_COUNTER_VALUE() runTimeCounterValue()
 #endif // configGENERATE_RUN_TIME_STATS
 
 #endif /* FREERTOS_CONFIG_H */
@@ -14,18 +14,20 @@ ButtonLedMatrix::ButtonLedMatrix(ShiftRegister &shiftRegister, bool invertLeds)
 void ButtonLedMatrix::init() {
     std::memset(_buttonState, 0, sizeof(_buttonState));
     std::memset(_ledState, 0, sizeof(_ledState));
+    std::memset(_rowLedsOn, 0, sizeof(_rowLedsOn));
+    std::memset(_rowLedsDimmed, 0, sizeof(_rowLedsDimmed));
 }
 
 void ButtonLedMatrix::process() {
     uint8_t rowData = ~(1 << _row);
-    uint8_t ledData = 0;
-    for (int col = 0; col < ColsLed; ++col) {
-        int index = col * Rows + _row;
-        if (_ledState[index].red.update()) {
-            ledData |= (1 << (col * 2 + 1));
-        }
-        if (_ledState[index].green.update()) {
-            ledData |= (1 << (col * 2));
+    uint8_t ledData = _rowLedsOn[_row];
+    uint8_t dimmed = _rowLedsDimmed[_row];
+    while (dimmed) {
+        int bit = __builtin_ctz(dimmed);
+        dimmed &= dimmed - 1;
+        auto &state = _ledState[(bit / 2) * Rows + _row];
+        if ((bit & 1) ? state.red.update() : state.green.update()) {
+            ledData |= (1 << bit);
         }
     }
 
@@ -35,6 +35,7 @@ public:
     static constexpr int Rows = CONFIG_BLM_ROWS;
     static constexpr int ColsButton = CONFIG_BLM_COLS_BUTTON;
     static constexpr int ColsLed = CONFIG_BLM_COLS_LED;
+    static_assert(ColsLed * 2 <= 8, "led row data must fit into 8 bits");
 
     ButtonLedMatrix(ShiftRegister &shiftRegister, bool invertLeds = false);
 
@@ -44,14 +45,20 @@ public:
         if (_invertLeds) {
             std::swap(red, green);
         }
-        _ledState[index].red.intensity = red >> 4;
-        _ledState[index].green.intensity = green >> 4;
+        auto &state = _ledState[index];
+        state.red.intensity = red >> 4;
+        state.green.intensity = green >> 4;
         if (red == 0) {
-            _ledState[index].red.counter = 0;
+            state.red.counter = 0;
         }
         if (green == 0) {
-            _ledState[index].green.counter = 0;
+            state.green.counter = 0;
         }
+
+        int row = index % Rows;
+        int col = index / Rows;
+        updateRowMasks(row, 1 << (col * 2 + 1), state.red);
+        updateRowMasks(row, 1 << (col * 2), state.green);
     }
 
     inline void setLed(int row, int col, uint8_t red, uint8_t green) {
@@ -100,6 +107,21 @@ private:
         Led green;
     } __attribute__((packed));
 
+    // LEDs at full or zero intensity (and zero counter) do not need PWM, their state in
+    // the row data is fixed. Only the remaining dimmed LEDs are evaluated in process().
+    void updateRowMasks(int row, uint8_t bit, const Led &led) {
+        if (led.intensity == 0x0f) {
+            _rowLedsOn[row] |= bit;
+            _rowLedsDimmed[row] &= ~bit;
+        } else if (led.intensity == 0 && led.counter == 0) {
+            _rowLedsOn[row] &= ~bit;
+            _rowLedsDimmed[row] &= ~bit;
+        } else {
+            _rowLedsOn[row] &= ~bit;
+            _rowLedsDimmed[row] |= bit;
+        }
+    }
+
     struct ButtonState {
         uint8_t state;
         // uint8_t counter : 7;
@@ -110,6 +132,8 @@ private:
 
     ButtonState _buttonState[Rows * ColsButton];
     LedState _ledState[Rows * ColsLed];
+    uint8_t _rowLedsOn[Rows];       // row data bits of LEDs that are always on
+    uint8_t _rowLedsDimmed[Rows];   // row data bits of LEDs that need PWM
 
     RingBuffer<Event, 16> _events;
 
@@ -1,4 +1,5 @@
 #include "Dac.h"
+#include "HighResolutionTimer.h"
 
 #include "hal/Delay.h"
 
@@ -70,12 +71,14 @@ void Dac::init() {
 
 void Dac::write(int channel) {
     writeDac(WRITE_INPUT_REGISTER_UPDATE_N, channel, _values[channel], 15);
+    _updateUs = HighResolutionTimer::us();
 }
 
 void Dac::write() {
     for (int channel = 0; channel < Channels; ++channel) {
         writeDac(channel == 7 ? WRITE_INPUT_REGISTER_UPDATE_ALL : WRITE_INPUT_REGISTER, channel, _values[channel], 0);
     }
+    _updateUs = HighResolutionTimer::us();
 }
 
 void Dac::writeDac(uint8_t command, uint8_t address, uint16_t data, uint8_t function) {
@@ -27,6 +27,9 @@ public:
     void write(int channel);
     void write();
 
+    // time the outputs were last updated in us
+    uint32_t updateUs() const { return _updateUs; }
+
 private:
     void writeDac(uint8_t command, uint8_t address, uint16_t data, uint8_t function);
 
@@ -44,4 +47,5 @@ private:
 
     Value _values[Channels];
     uint32_t _dataShift = 0;
+    uint32_t _updateUs = 0;
 };
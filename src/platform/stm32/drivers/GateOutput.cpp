@@ -1,4 +1,5 @@
 #include "GateOutput.h"
+#include "HighResolutionTimer.h"
 
 GateOutput::GateOutput(ShiftRegister &shiftRegister) :
     _shiftRegister(shiftRegister)
@@ -8,5 +9,8 @@ void GateOutput::init() {
 }
 
 void GateOutput::update() {
-    _shiftRegister.write(2, _gates);
+    // latch right away instead of waiting for the next shift register update
+    // in the driver task, so gates change together with the cv written before
+    _shiftRegister.latch(2, _gates);
+    _latchUs = HighResolutionTimer::us();
 }
@@ -12,6 +12,9 @@ public:
 
     void update();
 
+    // time the gates were last latched in us
+    uint32_t latchUs() const { return _latchUs; }
+
     inline uint8_t gates() const { return _gates; }
 
     inline void setGates(uint8_t gates) {
@@ -29,4 +32,5 @@ public:
 private:
     ShiftRegister &_shiftRegister;
     uint8_t _gates = 0;
+    uint32_t _latchUs = 0;
 };
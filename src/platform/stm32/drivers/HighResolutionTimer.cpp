@@ -37,11 +37,3 @@ void tim2_isr() {
         HighResolutionTimer::tick();
     }
 }
-
-extern "C" {
-
-uint32_t highResolutionTimerTicks() {
-    return HighResolutionTimer::us();
-}
-
-}
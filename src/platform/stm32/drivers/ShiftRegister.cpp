@@ -5,6 +5,8 @@
 #include "core/profiler/Profiler.h"
 #include "core/Debug.h"
 
+#include "os/os.h"
+
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/spi.h>
@@ -28,7 +30,6 @@
 #define SPI_GPIO (SPI_SCK | SPI_MISO | SPI_MOSI)
 
 ShiftRegister::ShiftRegister() {
-    _outputs.fill(0u);
     _inputs.fill(0u);
 }
 
@@ -66,13 +67,33 @@ void ShiftRegister::init() {
 }
 
 void ShiftRegister::process() {
+    // the engine task latches gate outputs in between (see latch()),
+    // the transfer of the 3 registers takes ~3us
+    os::InterruptLock lock;
+
     // trigger load line
     gpio_clear(SR_PORT, SR_LOAD);
     gpio_set(SR_PORT, SR_LOAD);
 
     // transfer data
+    const auto &outputs = _outputs.latchAll();
+    for (int sr = 0; sr < NumRegisters; ++sr) {
+        _inputs[sr] = spi_xfer(SR_SPI, outputs[NumRegisters - sr - 1]);
+    }
+
+    // trigger latch line
+    gpio_set(SR_PORT, SR_LATCH);
+    gpio_clear(SR_PORT, SR_LATCH);
+}
+
+void ShiftRegister::latch(int index, uint8_t value) {
+    os::InterruptLock lock;
+
+    // shift the last latched outputs without loading the inputs, the bytes
+    // shifted in are discarded and the inputs are loaded again by process()
+    const auto &outputs = _outputs.latch(index, value);
     for (int sr = 0; sr < NumRegisters; ++sr) {
-        _inputs[sr] = spi_xfer(SR_SPI, _outputs[NumRegisters - sr - 1]);
+        spi_xfer(SR_SPI, outputs[NumRegisters - sr - 1]);
     }
 
     // trigger latch line
@@ -2,6 +2,8 @@
 
 #include "SystemConfig.h"
 
+#include "core/utils/ShiftRegisterFrame.h"
+
 #include <array>
 
 #include <cstdint>
@@ -14,12 +16,16 @@ public:
 
     void init();
 
+    // transfer outputs and inputs, outputs are latched at the end
     void process();
 
+    // latch a single output right away, other outputs and inputs are left to process()
+    void latch(int index, uint8_t value);
+
     uint8_t read(int index) const { return _inputs[index]; }
-    void write(int index, uint8_t value) { _outputs[index] = value; }
+    void write(int index, uint8_t value) { _outputs.write(index, value); }
 
 private:
-    std::array<uint8_t, NumRegisters> _outputs;
+    ShiftRegisterFrame<NumRegisters> _outputs;
     std::array<uint8_t, NumRegisters> _inputs;
 };
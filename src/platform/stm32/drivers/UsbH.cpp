@@ -5,6 +5,8 @@
 
 #include "core/Debug.h"
 #include "core/midi/MidiMessage.h"
+#include "core/midi/UsbMidiOutputQueue.h"
+#include "core/midi/UsbMidiSysExAssembler.h"
 
 #include "usbh_core.h"
 #include "usbh_lld_stm32f4.h"
@@ -12,6 +14,7 @@
 #include "usbh_driver_ac_midi.h"
 #include "usbh_driver_hid.h"
 
+#include <algorithm>
 #include <cstdio>
 
 #include <libopencm3/stm32/rcc.h>
@@ -45,24 +48,59 @@ static const usbh_low_level_driver_t * const lld_drivers[] = {
 	nullptr
 };
 
-static constexpr size_t WriteBufferSize = 64;
-static uint8_t writeBuffer[2][WriteBufferSize];
-static size_t writeBufferSize;
-static size_t writeBufferIndex;
-static size_t writeBufferPos;
+// MIDI output. Messages from the UsbMidi tx queue are packed into bulk packets
+// of up to 16 events. The app has a single USB MIDI port, which is sent to
+// device 0 only. Mirroring it to all devices would send controller LED traffic
+// to synths and sequencer notes to controllers, so there is a single output
+// queue. The driver keeps a single write transfer per device, so the next
+// packet is only written once the previous one has completed.
+static constexpr uint8_t MidiOutputDevice = 0;
+static constexpr size_t MidiPacketSize = 64;
+static constexpr size_t MidiOutputQueueSize = 128;
+// bulk packets per process() call when the host controller keeps up
+static constexpr int MidiPacketsPerProcess = 4;
+
+struct MidiOutput {
+    UsbMidiOutputQueue<MidiOutputQueueSize> queue;
+    uint8_t packet[MidiPacketSize];
+    size_t packetSize = MidiPacketSize;
+    size_t transferSize = 0;
+    // events of transfers that failed or could not be started
+    volatile uint32_t lostEvents = 0;
+    volatile bool busy = false;
+};
+
+static MidiOutput midiOutput;
+
+// Per-device SysEx input. Received messages are passed on as MidiMessage
+// payloads, so they are limited to the size of a payload pool slot.
+static constexpr size_t MidiSysExSize = 16;
+
+static UsbMidiSysExAssembler<MidiSysExSize> midiSysExInputs[USBH_AC_MIDI_MAX_DEVICES];
 
 struct MidiDriverHandler {
 
     static void connectHandler(int device, uint16_t vendorId, uint16_t productId, uint32_t maxPacketSize) {
         DBG("MIDI device connected (id=%d, vendorId=%04x, productId=%04x, maxPacketSize=%ld)", device, vendorId, productId, maxPacketSize);
+        if (device < 0 || device >= USBH_AC_MIDI_MAX_DEVICES) {
+            return;
+        }
+        if (device == MidiOutputDevice) {
+            midiOutput.queue.clear();
+            midiOutput.packetSize = std::min(MidiPacketSize, size_t(maxPacketSize));
+            midiOutput.busy = false;
+        }
         if (g_usbh) {
             g_usbh->midiConnectDevice(device, vendorId, productId);
         }
-        writeBufferSize = std::min(WriteBufferSize, size_t(maxPacketSize));
     }
 
     static void disconnectHandler(int device) {
         DBG("MIDI device disconnected (id=%d)", device);
+        if (device == MidiOutputDevice) {
+            midiOutput.queue.clear();
+            midiOutput.busy = false;
+        }
         if (g_usbh) {
             g_usbh->midiDisconnectDevice(device);
         }
@@ -77,11 +115,17 @@ struct MidiDriverHandler {
         switch (code) {
         case 0x0:
         case 0x1:
+            return;
         case 0x4:
         case 0x6:
         case 0x7:
+            recvSysEx(device, cable, data);
             return;
         case 0x5:
+            if (data[1] == 0xf7) {
+                recvSysEx(device, cable, data);
+                return;
+            }
             message = MidiMessage(data[1]);
             g_usbh->midiEnqueueMessage(device, cable, message);
             break;
@@ -106,86 +150,41 @@ struct MidiDriverHandler {
         }
     }
 
-    static bool write(uint8_t device, uint8_t cable, const MidiMessage &message) {
-        bool flushed = true;
-
-        if (message.isSystemExclusive()) {
-            const uint8_t *payloadData = message.payloadData();
-            size_t payloadLength = message.payloadLength();
-            if (payloadData && payloadLength > 0) {
-                size_t messageLength = payloadLength + 2;
-                size_t writeSize = ((messageLength + 3) / 4) * 4;
-                if (writeBufferPos + writeSize >= writeBufferSize) {
-                    flush(device);
-                    flushed = true;
-                }
-
-                size_t messageIndex = 0;
-                while (messageIndex < messageLength) {
-                    uint8_t *p = &writeBuffer[writeBufferIndex][writeBufferPos];
-                    size_t chunkSize;
-                    switch (messageLength - messageIndex) {
-                    case 1:
-                        p[0] = 0x5;
-                        chunkSize = 1;
-                        break;
-                    case 2:
-                        p[0] = 0x6;
-                        chunkSize = 2;
-                        break;
-                    case 3:
-                        p[0] = 0x7;
-                        chunkSize = 3;
-                        break;
-                    default:
-                        p[0] = 0x4;
-                        chunkSize = 3;
-                        break;
-                    }
-                    p[0] |= cable << 4;
-                    for (size_t i = 0; i < chunkSize; ++i) {
-                        uint8_t byte;
-                        if (messageIndex == 0) {
-                            byte = 0xf0;
-                        } else if (messageIndex == messageLength - 1) {
-                            byte = 0xf7;
-                        } else {
-                            byte = payloadData[messageIndex - 1];
-                        }
-                        p[1 + i] = byte;
-                        ++messageIndex;
-                    }
-                    for (size_t i = chunkSize; i < 3; ++i) {
-                        p[1 + i] = 0;
-                    }
-                    writeBufferPos += 4;
-                }
-            }
-        } else {
-            if (writeBufferPos + 4 >= writeBufferSize) {
-                flush(device);
-                flushed = true;
-            }
-            uint8_t *p = &writeBuffer[writeBufferIndex][writeBufferPos];
-            p[0] = message.status() >> 4 | (cable << 4);
-            p[1] = message.status();
-            p[2] = message.data0();
-            p[3] = message.data1();
-            writeBufferPos += 4;
+    static void recvSysEx(int device, uint8_t cable, const uint8_t *data) {
+        if (device < 0 || device >= USBH_AC_MIDI_MAX_DEVICES) {
+            return;
+        }
+        auto &input = midiSysExInputs[device];
+        if (input.feed(data)) {
+            g_usbh->midiEnqueueMessage(device, cable, MidiMessage::makeSystemExclusive(input.data(), input.length()));
         }
-
-        return flushed;
     }
 
-    static void flush(uint8_t device) {
-        if (writeBufferPos > 0) {
-            usbh_midi_write(device, writeBuffer[writeBufferIndex], writeBufferPos, &writeCallback);
-            writeBufferIndex = (writeBufferIndex + 1) % 2;
-            writeBufferPos = 0;
+    // write the next bulk packet, returns false if the device is busy or there is nothing to send
+    static bool flush() {
+        auto &output = midiOutput;
+        if (output.busy || output.queue.empty()) {
+            return false;
+        }
+        size_t size = output.queue.pack(output.packet, output.packetSize);
+        output.transferSize = size;
+        output.busy = true;
+        if (!usbh_midi_write(MidiOutputDevice, output.packet, size, &writeCallback)) {
+            // no transfer was started (device without an out endpoint), the callback is never called
+            output.lostEvents += size / UsbMidiOutputQueue<MidiOutputQueueSize>::EventSize;
+            output.busy = false;
+            return false;
         }
+        return true;
     }
 
     static void writeCallback(uint8_t bytes_written) {
+        auto &output = midiOutput;
+        if (bytes_written < output.transferSize) {
+            constexpr size_t EventSize = UsbMidiOutputQueue<MidiOutputQueueSize>::EventSize;
+            output.lostEvents += (output.transferSize - bytes_written + EventSize - 1) / EventSize;
+        }
+        output.busy = false;
     }
 };
 
@@ -264,22 +263,32 @@ void UsbH::process() {
         }
     }
 
-    uint8_t device = 0;
+    processMidiOutput();
+}
+
+void UsbH::processMidiOutput() {
+    bool connected = midiDeviceConnected(MidiOutputDevice);
     uint8_t cable = 0;
     MidiMessage message;
-    bool flushed = false;
-    while (midiDequeueMessage(&device, &cable, &message)) {
-        if (midiDeviceConnected(device)) {
-            flushed = MidiDriverHandler::write(device, cable, message);
-            if (flushed) {
-                break;
-            }
+    while (midiDequeueMessage(&cable, &message)) {
+        if (connected && !midiOutput.queue.push(cable, message)) {
+            ++_usbMidi._txOverflow;
         }
     }
-    if (!flushed) {
-        MidiDriverHandler::flush(device);
+
+    // Write packets while the device is idle. A transfer that completes on the
+    // next poll frees the device for another packet in the same frame.
+    for (int round = 0; connected && round < MidiPacketsPerProcess; ++round) {
+        if (!MidiDriverHandler::flush()) {
+            break;
+        }
+        usbh_poll(HighResolutionTimer::us());
     }
 
+    _usbMidi._txQueueHighWater = std::max(uint32_t(_usbMidi._txQueueHighWater), midiOutput.queue.highWater());
+    // write callbacks run from usbh_poll() in this task
+    _usbMidi._txOverflow += midiOutput.lostEvents;
+    midiOutput.lostEvents = 0;
 }
 
 bool UsbH::recvKey(HidKeyEvent *event) {
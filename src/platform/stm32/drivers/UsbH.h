@@ -57,11 +57,13 @@ private:
         _usbMidi.enqueueData(cable, data);
     }
 
-    bool midiDequeueMessage(uint8_t *device, uint8_t *cable, MidiMessage *message) {
-        *device = 0;
+    // output of the single USB MIDI port, sent to one device (see UsbH.cpp)
+    bool midiDequeueMessage(uint8_t *cable, MidiMessage *message) {
         return _usbMidi.dequeueMessage(cable, message);
     }
 
+    void processMidiOutput();
+
     void hidConnectDevice(uint8_t device, HID_TYPE type) {
         _hidDevices |= (1 << device);
         if (_hidConnectCallback) {
@@ -17,6 +17,7 @@ public:
 
     bool send(uint8_t cable, const MidiMessage &message) {
         if (_txQueue.full()) {
+            ++_txOverflow;
             return false;
         }
         _txQueue.write({ cable, message });
@@ -47,6 +48,11 @@ public:
 
     uint32_t rxOverflow() const { return 0; }
 
+    // messages dropped on the way out (tx queue or the device output queue full, events of failed transfers)
+    uint32_t txOverflow() const { return _txOverflow; }
+    // deepest output queue seen (in USB-MIDI events)
+    uint32_t txQueueHighWater() const { return _txQueueHighWater; }
+
 private:
     void connect(uint16_t vendorId, uint16_t productId) {
         if (_connectHandler) {
@@ -96,6 +102,8 @@ private:
     RingBuffer<CableAndMessage, 128> _txQueue;
     RingBuffer<CableAndMessage, 16> _rxQueue;
     volatile uint32_t _rxOverflow = 0;
+    volatile uint32_t _txOverflow = 0;
+    volatile uint32_t _txQueueHighWater = 0;
 
     friend class UsbH;
 };
@@ -55,8 +55,9 @@ void midi_driver_init(const midi_config_t *config);
  * @param data
  * @param length
  * @param callback this is called when the write call finishes
+ * @return false if no transfer was started, the callback is not called in this case
  */
-void usbh_midi_write(uint8_t device_id, const void *data, uint32_t length, midi_write_callback_t callback);
+bool usbh_midi_write(uint8_t device_id, const void *data, uint32_t length, midi_write_callback_t callback);
 
 extern const usbh_dev_driver_t usbh_midi_driver;
 
@@ -3,8 +3,9 @@
 
 #include "core/Debug.h"
 
-#include "FreeRTOS.h"
-#include "task.h"
+#include "os.h"
+
+#include <libopencm3/cm3/dwt.h>
 
 extern "C" {
 
@@ -79,6 +80,23 @@ static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
 }
 
 
+#if CONFIG_ENABLE_TASK_PROFILER
+/* Run time stats count cpu cycles with the DWT cycle counter. It wraps every
+25s at 168MHz, which is fine as long as the per-task counters are sampled more
+often than that (see os::TaskProfiler::sample()). */
+void runTimeCounterInit() {
+    dwt_enable_cycle_counter();
+}
+
+uint32_t runTimeCounterValue() {
+    return dwt_read_cycle_counter();
+}
+
+void vApplicationTickHook() {
+    os::TaskProfiler::tick();
+}
+#endif // CONFIG_ENABLE_TASK_PROFILER
+
 void vAssertCalled(const char *filename, unsigned long line) {
 #if CONFIG_ENABLE_DEBUG
     dbg_assert(false, filename, line, "OS");
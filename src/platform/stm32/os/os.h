@@ -15,6 +15,7 @@ extern "C" {
 #include <algorithm>
 
 #include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
 
 namespace os {
 
@@ -27,8 +28,6 @@ namespace os {
             TaskHandle handle;
             uint16_t stackSize;
             uint32_t lastRunTimeCounter;
-            uint32_t runTime;
-            uint32_t relativeRunTime;
         };
 
         static void registerTask(TaskInfo *taskInfo) {
@@ -39,7 +38,31 @@ namespace os {
             *tail = taskInfo;
         }
 
-        static void dump();
+        // Calls func(name, runTime, stackSize, stackFree) for every registered task and the idle task.
+        // runTime is in run time counter units (cpu cycles) since the last call, stackSize and
+        // stackFree (high-water mark since boot) in bytes. Scans the task stacks, call once a second or so.
+        template<typename Func>
+        static void sample(Func func) {
+            enumerate([&] (TaskInfo &info) {
+                TaskStatus_t taskStatus;
+                vTaskGetInfo(info.handle, &taskStatus, pdTRUE, eRunning);
+                uint32_t runTime = taskStatus.ulRunTimeCounter - info.lastRunTimeCounter;
+                info.lastRunTimeCounter = taskStatus.ulRunTimeCounter;
+                func(taskStatus.pcTaskName, runTime, info.stackSize, uint16_t(taskStatus.usStackHighWaterMark * sizeof(StackType_t)));
+            });
+        }
+
+        // tick hook, records the cycle counter at the tick interrupt
+        static void tick() {
+            _tick = xTaskGetTickCountFromISR();
+            _tickCycles = dwt_read_cycle_counter();
+        }
+
+        // tick count and cycles since its interrupt, call with interrupts disabled
+        static uint32_t cyclesSinceTick(uint32_t &tick) {
+            tick = _tick;
+            return dwt_read_cycle_counter() - _tickCycles;
+        }
 
     private:
         template<typename Func>
@@ -50,11 +73,14 @@ namespace os {
                 info = info->next;
             }
             _idleTaskInfo.handle = xTaskGetIdleTaskHandle();
+            _idleTaskInfo.stackSize = configMINIMAL_STACK_SIZE * sizeof(StackType_t);
             func(_idleTaskInfo);
         }
 
         static TaskInfo *_taskInfos;
         static TaskInfo _idleTaskInfo;
+        static volatile uint32_t _tick;
+        static volatile uint32_t _tickCycles;
     };
 
     template<size_t StackSize>
@@ -257,6 +283,35 @@ namespace os {
         vTaskDelayUntil(&lastWakeupTime, ticks);
     }
 
+#if CONFIG_ENABLE_TASK_PROFILER
+    // Measures how late a periodic task (see PeriodicTask) starts running after its intended
+    // release, from the tick interrupt of the release with the cycle counter.
+    class ReleaseTimer {
+    public:
+        // call first thing in every period, returns the latency in us (0 for the first release)
+        uint32_t release(uint32_t interval) {
+            uint32_t tick;
+            uint32_t cycles;
+            {
+                InterruptLock lock;
+                cycles = TaskProfiler::cyclesSinceTick(tick);
+            }
+            if (!_started) {
+                _started = true;
+                _expected = tick + interval;
+                return 0;
+            }
+            int32_t lateTicks = std::max(int32_t(tick - _expected), int32_t(0));
+            _expected += interval;
+            return uint32_t(lateTicks) * (1000000 / configTICK_RATE_HZ) + cycles / (configCPU_CLOCK_HZ / 1000000);
+        }
+
+    private:
+        bool _started = false;
+        uint32_t _expected;
+    };
+#endif // CONFIG_ENABLE_TASK_PROFILER
+
     inline void startScheduler() {
         vTaskStartScheduler();
     }
@@ -0,0 +1,89 @@
+#include "UnitTest.h"
+
+#include "core/midi/UsbMidiOutputQueue.h"
+
+static uint8_t payloadPool[256];
+
+UNIT_TEST("UsbMidiOutputQueue") {
+
+    MidiMessage::setPayloadPool(payloadPool, sizeof(payloadPool));
+
+    CASE("channel messages are packed 16 per bulk packet") {
+        UsbMidiOutputQueue<64> queue;
+        for (int i = 0; i < 20; ++i) {
+            expectTrue(queue.push(1, MidiMessage::makeNoteOn(2, 60 + i, 100)));
+        }
+        expectEqual(queue.entries(), size_t(20));
+
+        uint8_t packet[64];
+        expectEqual(queue.pack(packet, sizeof(packet)), size_t(64));
+        expectEqual(packet[0], uint8_t(0x19));
+        expectEqual(packet[1], uint8_t(0x92));
+        expectEqual(packet[2], uint8_t(60));
+        expectEqual(packet[3], uint8_t(100));
+        expectEqual(packet[60 + 2], uint8_t(75));
+
+        expectEqual(queue.pack(packet, sizeof(packet)), size_t(16));
+        expectEqual(packet[2], uint8_t(76));
+        expectTrue(queue.empty());
+        expectEqual(queue.pack(packet, sizeof(packet)), size_t(0));
+    }
+
+    CASE("packets respect the device packet size") {
+        UsbMidiOutputQueue<64> queue;
+        for (int i = 0; i < 4; ++i) {
+            queue.push(0, MidiMessage::makeNoteOff(0, 60 + i));
+        }
+        uint8_t packet[64];
+        expectEqual(queue.pack(packet, 8), size_t(8));
+        expectEqual(queue.pack(packet, 10), size_t(8));
+        expectTrue(queue.empty());
+    }
+
+    CASE("sysex is split into 3 byte chunks across packets") {
+        UsbMidiOutputQueue<64> queue;
+        uint8_t payload[50];
+        for (int i = 0; i < 50; ++i) {
+            payload[i] = i;
+        }
+        // 52 bytes with F0/F7 -> 18 events
+        expectTrue(queue.push(0, MidiMessage::makeSystemExclusive(payload, sizeof(payload))));
+        expectEqual(queue.entries(), size_t(18));
+
+        uint8_t bytes[128];
+        size_t size = queue.pack(bytes, 64);
+        size += queue.pack(bytes + size, 64);
+        expectEqual(size, size_t(72));
+
+        expectEqual(bytes[0], uint8_t(0x04));
+        expectEqual(bytes[1], uint8_t(0xf0));
+        expectEqual(bytes[2], uint8_t(0));
+        expectEqual(bytes[3], uint8_t(1));
+        expectEqual(bytes[64], uint8_t(0x04));
+        expectEqual(bytes[67], uint8_t(49));
+        // last event only carries F7
+        expectEqual(bytes[68], uint8_t(0x05));
+        expectEqual(bytes[69], uint8_t(0xf7));
+        expectEqual(bytes[70], uint8_t(0));
+    }
+
+    CASE("messages that do not fit are dropped and counted") {
+        UsbMidiOutputQueue<8> queue;
+        for (int i = 0; i < 10; ++i) {
+            queue.push(0, MidiMessage::makeNoteOn(0, 60, 100));
+        }
+        expectEqual(queue.entries(), size_t(7));
+        expectEqual(queue.dropped(), uint32_t(3));
+        expectEqual(queue.highWater(), uint32_t(7));
+
+        uint8_t payload[30] = {};
+        expectFalse(queue.push(0, MidiMessage::makeSystemExclusive(payload, sizeof(payload))));
+        expectEqual(queue.entries(), size_t(7));
+        expectEqual(queue.dropped(), uint32_t(4));
+
+        queue.clear();
+        expectTrue(queue.empty());
+        expectEqual(queue.dropped(), uint32_t(4));
+    }
+
+}
@@ -0,0 +1,64 @@
+#include "UnitTest.h"
+
+#include "core/midi/UsbMidiSysExAssembler.h"
+
+UNIT_TEST("UsbMidiSysExAssembler") {
+
+    CASE("messages spanning several events are reassembled without framing") {
+        UsbMidiSysExAssembler<16> assembler;
+        const uint8_t events[][4] = {
+            { 0x14, 0xf0, 0x7d, 0x58 },
+            { 0x14, 0x01, 0x02, 0x03 },
+            { 0x16, 0x04, 0xf7, 0x00 },
+        };
+        expectFalse(assembler.feed(events[0]));
+        expectFalse(assembler.feed(events[1]));
+        expectTrue(assembler.feed(events[2]));
+        expectEqual(assembler.length(), size_t(6));
+        expectEqual(assembler.data()[0], uint8_t(0x7d));
+        expectEqual(assembler.data()[5], uint8_t(0x04));
+    }
+
+    CASE("all end codes complete a message") {
+        UsbMidiSysExAssembler<16> assembler;
+        const uint8_t single[] = { 0x14, 0xf0, 0x01, 0x02 };
+        const uint8_t end1[] = { 0x05, 0xf7, 0x00, 0x00 };
+        expectFalse(assembler.feed(single));
+        expectTrue(assembler.feed(end1));
+        expectEqual(assembler.length(), size_t(2));
+
+        const uint8_t end2[] = { 0x06, 0xf0, 0xf7, 0x00 };
+        expectTrue(assembler.feed(end2));
+        expectEqual(assembler.length(), size_t(0));
+
+        const uint8_t end3[] = { 0x07, 0xf0, 0x42, 0xf7 };
+        expectTrue(assembler.feed(end3));
+        expectEqual(assembler.length(), size_t(1));
+        expectEqual(assembler.data()[0], uint8_t(0x42));
+    }
+
+    CASE("overlong messages are dropped and counted") {
+        UsbMidiSysExAssembler<4> assembler;
+        const uint8_t start[] = { 0x04, 0xf0, 0x01, 0x02 };
+        const uint8_t data[] = { 0x04, 0x03, 0x04, 0x05 };
+        const uint8_t end[] = { 0x05, 0xf7, 0x00, 0x00 };
+        expectFalse(assembler.feed(start));
+        expectFalse(assembler.feed(data));
+        expectFalse(assembler.feed(end));
+        expectEqual(assembler.dropped(), uint32_t(1));
+
+        // next message is received again
+        const uint8_t next[] = { 0x07, 0xf0, 0x11, 0xf7 };
+        expectTrue(assembler.feed(next));
+        expectEqual(assembler.length(), size_t(1));
+    }
+
+    CASE("end without start is ignored") {
+        UsbMidiSysExAssembler<16> assembler;
+        const uint8_t end[] = { 0x06, 0x01, 0xf7, 0x00 };
+        expectFalse(assembler.feed(end));
+        const uint8_t channel[] = { 0x09, 0x90, 0x3c, 0x64 };
+        expectFalse(assembler.feed(channel));
+    }
+
+}
@@ -0,0 +1,86 @@
+#include "UnitTest.h"
+
+#include "core/utils/ShiftRegisterFrame.h"
+
+// Registers as used on the hardware: button matrix row, button matrix leds, gates.
+enum { Row, Leds, Gates, Count };
+
+// The driver task stages the next matrix row and runs a full transfer every
+// millisecond, the engine task commits the gates in between.
+struct Hardware {
+    ShiftRegisterFrame<Count> frame;
+    int row = 0;
+    int transfers = 0;
+
+    void stageRow() {
+        frame.write(Row, ~(1 << row));
+        frame.write(Leds, row);
+    }
+
+    void driverTask() {
+        stageRow();
+        frame.latchAll();
+        ++transfers;
+        row = (row + 1) % 8;
+    }
+};
+
+UNIT_TEST("ShiftRegisterFrame") {
+
+    CASE("full transfer latches all staged bytes") {
+        ShiftRegisterFrame<Count> frame;
+        frame.write(Row, 1);
+        frame.write(Leds, 2);
+        frame.write(Gates, 3);
+        expectEqual(frame.latched(Gates), uint8_t(0));
+        const auto &bytes = frame.latchAll();
+        expectEqual(bytes[Row], uint8_t(1));
+        expectEqual(bytes[Leds], uint8_t(2));
+        expectEqual(bytes[Gates], uint8_t(3));
+    }
+
+    CASE("gate latch shifts the last latched row and leds") {
+        ShiftRegisterFrame<Count> frame;
+        frame.write(Row, 0xfe);
+        frame.write(Leds, 0x0f);
+        frame.latchAll();
+
+        // the matrix stages its next row, the engine commits the gates before the next transfer
+        frame.write(Row, 0xfd);
+        frame.write(Leds, 0xf0);
+        const auto &bytes = frame.latch(Gates, 0x81);
+        expectEqual(bytes[Row], uint8_t(0xfe));
+        expectEqual(bytes[Leds], uint8_t(0x0f));
+        expectEqual(bytes[Gates], uint8_t(0x81));
+
+        // staged bytes stay pending for the next transfer, which keeps the gates
+        expectEqual(frame.staged(Row), uint8_t(0xfd));
+        expectEqual(frame.staged(Leds), uint8_t(0xf0));
+        frame.latchAll();
+        expectEqual(frame.latched(Row), uint8_t(0xfd));
+        expectEqual(frame.latched(Leds), uint8_t(0xf0));
+        expectEqual(frame.latched(Gates), uint8_t(0x81));
+    }
+
+    CASE("gates reach the outputs with the engine commit, matrix rows only with the driver transfers") {
+        Hardware hardware;
+        for (int ms = 0; ms < 100; ++ms) {
+            hardware.driverTask();
+            uint8_t row = hardware.frame.latched(Row);
+            uint8_t leds = hardware.frame.latched(Leds);
+
+            // engine frame released after the matrix staged its next row
+            hardware.stageRow();
+            uint8_t gates = uint8_t(ms * 37);
+            hardware.frame.latch(Gates, gates);
+
+            // no skew between the commit and the gate outputs
+            expectEqual(hardware.frame.latched(Gates), gates);
+            // the matrix pipeline is unchanged: one row per transfer
+            expectEqual(hardware.frame.latched(Row), row);
+            expectEqual(hardware.frame.latched(Leds), leds);
+        }
+        expectEqual(hardware.transfers, 100);
+    }
+
+}
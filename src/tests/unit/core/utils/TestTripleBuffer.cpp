@@ -0,0 +1,59 @@
+#include "UnitTest.h"
+
+#include "core/utils/TripleBuffer.h"
+
+UNIT_TEST("TripleBuffer") {
+
+    CASE("update without publish") {
+        TripleBuffer<int> buffer;
+        expectFalse(buffer.update());
+        expectEqual(buffer.read(), 0);
+    }
+
+    CASE("publish/update") {
+        TripleBuffer<int> buffer;
+        buffer.write() = 1;
+        buffer.publish();
+        expectTrue(buffer.update());
+        expectEqual(buffer.read(), 1);
+        expectFalse(buffer.update());
+        expectEqual(buffer.read(), 1);
+    }
+
+    CASE("consumer gets the latest value") {
+        TripleBuffer<int> buffer;
+        for (int i = 1; i <= 5; ++i) {
+            buffer.write() = i;
+            buffer.publish();
+        }
+        expectTrue(buffer.update());
+        expectEqual(buffer.read(), 5);
+    }
+
+    CASE("front buffer is stable while producer writes") {
+        TripleBuffer<int> buffer;
+        buffer.write() = 1;
+        buffer.publish();
+        expectTrue(buffer.update());
+        for (int i = 2; i < 10; ++i) {
+            buffer.write() = i;
+            buffer.publish();
+            expectEqual(buffer.read(), 1);
+        }
+        expectTrue(buffer.update());
+        expectEqual(buffer.read(), 9);
+    }
+
+    CASE("interleaved publish/update") {
+        TripleBuffer<int> buffer;
+        for (int i = 1; i < 100; ++i) {
+            buffer.write() = i;
+            buffer.publish();
+            if (i % 3 == 0) {
+                expectTrue(buffer.update());
+                expectEqual(buffer.read(), i);
+            }
+        }
+    }
+
+}
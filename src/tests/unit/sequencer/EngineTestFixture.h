@@ -7,6 +7,7 @@
 #include "drivers/Dac.h"
 #include "drivers/Dio.h"
 #include "drivers/GateOutput.h"
+#include "drivers/HighResolutionTimer.h"
 #include "drivers/Midi.h"
 #include "drivers/UsbMidi.h"
 #include "drivers/UsbH.h"
@@ -15,6 +16,8 @@
 #include "apps/sequencer/model/Project.h"
 #include "apps/sequencer/engine/Engine.h"
 
+#include <functional>
+
 // Headless engine harness: real sim drivers + the Simulator singleton + Model +
 // Engine, driven by Simulator::wait() (deterministic fake-tick time, no GUI).
 // The Simulator must be constructed before any driver — each driver touches
@@ -23,7 +26,15 @@
 // .tasks/review-fixes-tdd/PLAN.md Phase 0.
 class EngineTestFixture {
 public:
-    EngineTestFixture() {
+    // With a stepped wall clock the engine sees exactly 1000 us per step
+    // instead of host time, so wall clock timed work (modulators, TT2 metro and
+    // delays) is deterministic regardless of host load.
+    explicit EngineTestFixture(bool steppedWallClock = false) :
+        _steppedWallClock(steppedWallClock)
+    {
+        if (_steppedWallClock) {
+            HighResolutionTimer::setManual(true);
+        }
         _model.init();
         _engine.init();
         // The Clock boots with a pending Reset event (Clock.h: _requestedEvents
@@ -31,7 +42,24 @@ public:
         // Reset drains before play is pressed. Drain it here — otherwise a Reset
         // queued alongside the first Start would clobber the running state.
         _engine.update();
-        _simulator.addUpdateCallback([this] { _engine.update(); });
+        _simulator.addUpdateCallback([this] {
+            if (_steppedWallClock) {
+                HighResolutionTimer::advanceManual(1000);
+            }
+            if (_beforeUpdate) {
+                _beforeUpdate();
+            }
+            _engine.update();
+            if (_afterUpdate) {
+                _afterUpdate();
+            }
+        });
+    }
+
+    ~EngineTestFixture() {
+        if (_steppedWallClock) {
+            HighResolutionTimer::setManual(false);
+        }
     }
 
     Model &model() { return _model; }
@@ -47,6 +75,12 @@ public:
     // Drive a CV input to a fixed voltage (for deterministic routing sources).
     void setCvIn(int channel, float volts) { _simulator.setAdc(channel, volts); }
 
+    // Hooks run right before/after every Engine::update() (e.g. to measure its cost).
+    void setUpdateHooks(std::function<void()> before, std::function<void()> after) {
+        _beforeUpdate = before;
+        _afterUpdate = after;
+    }
+
 private:
     sim::Simulator _simulator{ sim::Target{ []{}, []{}, []{} } };
     ClockTimer _clockTimer;
@@ -59,4 +93,7 @@ private:
     UsbH _usbH;
     Model _model;
     Engine _engine{ _model, _clockTimer, _adc, _dac, _dio, _gateOutput, _midi, _usbMidi, _usbH };
+    std::function<void()> _beforeUpdate;
+    std::function<void()> _afterUpdate;
+    bool _steppedWallClock;
 };
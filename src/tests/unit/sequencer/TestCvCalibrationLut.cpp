@@ -0,0 +1,87 @@
+#include "UnitTest.h"
+
+#include "engine/CvCalibrationLut.h"
+#include "engine/CvFixed.h"
+
+#include "model/Calibration.h"
+
+#include "core/utils/Random.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+// The fixed point output stage must produce the same DAC values as the float
+// pipeline (CvOutput::setChannel() with float volts mapped through
+// Calibration::CvOutput::voltsToValue()) within 1 LSB.
+static int maxError(const Calibration::CvOutput &calibration, Random &rng) {
+    CvCalibrationLut lut;
+    lut.update(calibration);
+
+    int error = 0;
+    auto check = [&] (float volts) {
+        int expected = calibration.voltsToValue(volts);
+        int actual = lut.value(CvFixed::fromVolts(volts));
+        error = std::max(error, std::abs(actual - expected));
+    };
+
+    // sweep beyond the calibrated range, including the calibration points
+    for (int i = -7000; i <= 7000; ++i) {
+        check(i * 0.001f);
+    }
+    // note voltages
+    for (int note = -84; note <= 84; ++note) {
+        check(note / 12.f);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        check((rng.nextRange(2000000) / 1000000.f - 1.f) * 6.f);
+    }
+    return error;
+}
+
+UNIT_TEST("CvCalibrationLut") {
+
+    CASE("default calibration matches the float pipeline within 1 LSB") {
+        Random rng(1);
+        Calibration::CvOutput calibration;
+        calibration.clear();
+        expectTrue(maxError(calibration, rng) <= 1);
+    }
+
+    CASE("user calibrations match the float pipeline within 1 LSB") {
+        Random rng(2);
+        for (int round = 0; round < 50; ++round) {
+            Calibration::CvOutput calibration;
+            calibration.clear();
+            for (int index = 0; index < Calibration::CvOutput::ItemCount; ++index) {
+                if (rng.nextRange(3) == 0) {
+                    calibration.setItem(index, calibration.item(index) + int(rng.nextRange(401)) - 200);
+                    calibration.setUserDefined(index, true);
+                }
+            }
+            expectTrue(maxError(calibration, rng) <= 1);
+        }
+    }
+
+    CASE("table follows calibration edits") {
+        Calibration::CvOutput calibration;
+        calibration.clear();
+        CvCalibrationLut lut;
+        expectTrue(lut.update(calibration));
+        expectFalse(lut.update(calibration));
+
+        calibration.setItem(5, calibration.item(5) - 100);
+        calibration.setUserDefined(5, true);
+        expectTrue(lut.update(calibration));
+        expectEqual(int(lut.value(CvFixed::fromInt(0))), calibration.item(5));
+    }
+
+    CASE("float conversion round trips") {
+        for (int note = -120; note <= 120; ++note) {
+            float volts = note / 12.f;
+            CvFixed::Value value = CvFixed::fromVolts(volts);
+            expectTrue(std::abs(CvFixed::toVolts(value) - volts) <= 0.5f / CvFixed::One);
+            expectEqual(CvFixed::fromVolts(CvFixed::toVolts(value)), value);
+        }
+    }
+
+}
@@ -0,0 +1,118 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/EngineCommandQueue.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+UNIT_TEST("EngineCommandQueue") {
+
+    CASE("commands are applied in posting order") {
+        EngineCommandQueue<8> queue;
+        std::vector<int> order;
+        for (int i = 0; i < 5; ++i) {
+            expectTrue(queue.post([&order, i] () { order.push_back(i); }));
+        }
+        expectEqual(int(order.size()), 0);
+        expectEqual(queue.apply(), 5);
+        expectEqual(int(order.size()), 5);
+        for (int i = 0; i < 5; ++i) {
+            expectEqual(order[i], i);
+        }
+        expectTrue(queue.empty());
+        expectEqual(queue.apply(), 0);
+    }
+
+    CASE("post fails when full and recovers after apply") {
+        EngineCommandQueue<4> queue;
+        int sum = 0;
+        for (int i = 0; i < 4; ++i) {
+            expectTrue(queue.post([&sum] () { sum += 1; }));
+        }
+        expectFalse(queue.post([&sum] () { sum += 100; }));
+        expectEqual(queue.apply(), 4);
+        expectEqual(sum, 4);
+        // wrap around the ring a few times
+        for (int round = 0; round < 10; ++round) {
+            expectTrue(queue.post([&sum] () { sum += 1; }));
+            expectTrue(queue.post([&sum] () { sum += 1; }));
+            expectEqual(queue.apply(), 2);
+        }
+        expectEqual(sum, 24);
+    }
+
+    CASE("tickets report completion") {
+        EngineCommandQueue<4> queue;
+        int value = 0;
+        uint32_t first = 0, second = 0;
+        expectTrue(queue.post([&value] () { value = 1; }, &first));
+        expectTrue(queue.post([&value] () { value = 2; }, &second));
+        expectFalse(queue.applied(first));
+        expectFalse(queue.applied(second));
+        queue.apply();
+        expectTrue(queue.applied(first));
+        expectTrue(queue.applied(second));
+        expectEqual(value, 2);
+    }
+
+    CASE("captured state is destroyed after apply") {
+        struct Counted {
+            Counted(int &alive) : alive(&alive) { ++*this->alive; }
+            Counted(const Counted &other) : alive(other.alive) { ++*alive; }
+            ~Counted() { --*alive; }
+            int *alive;
+        };
+        EngineCommandQueue<4> queue;
+        int alive = 0;
+        {
+            Counted counted(alive);
+            expectTrue(queue.post([counted] () {}));
+        }
+        expectEqual(alive, 1);
+        queue.apply();
+        expectEqual(alive, 0);
+    }
+
+    CASE("multiple producers") {
+        static constexpr int Producers = 4;
+        static constexpr int CommandsPerProducer = 10000;
+        EngineCommandQueue<16> queue;
+        struct {
+            int counts[Producers] = {};
+            int lastIndex[Producers] = { -1, -1, -1, -1 };
+            bool ordered = true;
+        } state;
+        std::atomic<int> done(0);
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < Producers; ++p) {
+            producers.emplace_back([&, p] () {
+                for (int i = 0; i < CommandsPerProducer; ++i) {
+                    auto command = [&state, p, i] () {
+                        state.ordered &= state.lastIndex[p] == i - 1;
+                        state.lastIndex[p] = i;
+                        ++state.counts[p];
+                    };
+                    while (!queue.post(command)) {
+                        std::this_thread::yield();
+                    }
+                }
+                ++done;
+            });
+        }
+
+        while (done < Producers || !queue.empty()) {
+            queue.apply();
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        expectTrue(state.ordered, "commands of a single producer must stay in order");
+        for (int p = 0; p < Producers; ++p) {
+            expectEqual(state.counts[p], CommandsPerProducer);
+        }
+    }
+
+}
@@ -0,0 +1,89 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+// The snapshot published at the end of an engine frame must match the live
+// engine state of that frame.
+
+static bool matchesEngine(EngineTestFixture &fixture) {
+    auto &engine = fixture.engine();
+    const auto &snapshot = engine.snapshot();
+    if (snapshot.gateOutput != engine.gateOutput()) {
+        return false;
+    }
+    for (int channel = 0; channel < CONFIG_CV_OUTPUT_CHANNELS; ++channel) {
+        if (snapshot.cvOutput[channel] != engine.cvOutput().channel(channel)) {
+            return false;
+        }
+    }
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        const auto &trackEngine = engine.trackEngine(trackIndex);
+        const auto &state = snapshot.track(trackIndex);
+        if (state.trackMode != trackEngine.trackMode() ||
+            state.activity != trackEngine.activity() ||
+            state.mute != trackEngine.mute() ||
+            state.sequenceProgress != trackEngine.sequenceProgress()) {
+            return false;
+        }
+    }
+    for (int index = 0; index < Engine::BusCvCount; ++index) {
+        if (snapshot.busCv[index] != engine.busCv(index) || snapshot.busWriters[index] != engine.busWriters(index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+UNIT_TEST("EngineSnapshot") {
+
+CASE("snapshot matches engine state after each frame") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    fixture.project().setTrackMode(1, Track::TrackMode::Curve);
+    auto &sequence = fixture.project().track(0).noteTrack().sequence(0);
+    for (int step = 0; step < 16; step += 2) {
+        sequence.step(step).setGate(true);
+    }
+    fixture.advance(1);
+    fixture.start();
+
+    for (int i = 0; i < 50; ++i) {
+        fixture.advance(7);
+        expectTrue(fixture.engine().acquireSnapshot());
+        expectTrue(matchesEngine(fixture));
+    }
+}
+
+CASE("note track step position") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    fixture.advance(1);
+    fixture.start();
+    fixture.advance(500);
+    fixture.engine().acquireSnapshot();
+
+    const auto &noteEngine = static_cast<const NoteTrackEngine &>(fixture.engine().trackEngine(0));
+    expectEqual(int(fixture.engine().snapshot().track(0).currentStep), noteEngine.currentStep());
+    expectTrue(fixture.engine().snapshot().track(0).currentStep >= 0);
+}
+
+CASE("snapshot stays unchanged until acquired") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    fixture.advance(1);
+    fixture.start();
+    fixture.advance(500);
+    fixture.engine().acquireSnapshot();
+
+    const auto &noteEngine = static_cast<const NoteTrackEngine &>(fixture.engine().trackEngine(0));
+    int step = fixture.engine().snapshot().track(0).currentStep;
+    expectEqual(step, noteEngine.currentStep());
+    fixture.advance(500);
+    expectTrue(noteEngine.currentStep() != step);
+    expectEqual(int(fixture.engine().snapshot().track(0).currentStep), step);
+    expectTrue(fixture.engine().acquireSnapshot());
+    expectEqual(int(fixture.engine().snapshot().track(0).currentStep), noteEngine.currentStep());
+    expectFalse(fixture.engine().acquireSnapshot());
+}
+
+}
@@ -0,0 +1,294 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/model/Routing.h"
+
+#include <algorithm>
+#include <initializer_list>
+
+#include <cstdio>
+
+#include <time.h>
+
+extern "C" {
+#include "command.h"
+#include "ops/op_enum.h"
+}
+
+// Worst-case engine load regression suite.
+//
+// Each scenario sets up tracks with adversarial but valid parameters, runs the
+// engine for a fixed number of frames and fails when the cost per frame
+// exceeds its budget. The engine runs on a stepped wall clock, so every run
+// does the same work. Costs are thread CPU time in units of a reference
+// workload that does not touch engine code, measured in the same windows.
+// This keeps the budgets independent of host speed and still catches
+// slowdowns of code all scenarios share (Engine::updateImpl, the note track
+// engine). Every scenario takes the cheapest of several windows and is measured
+// again when over budget, to filter out scheduling noise on the host.
+//
+// Engine code gains a lot more from optimization than the reference loop, so
+// there is a budget for optimized and one for unoptimized builds. Budgets are
+// about 1.5 times the cost measured when they were set. A scenario failing
+// here means a hot path got slower, check the printed costs against the budget
+// table before raising a budget.
+namespace {
+
+constexpr int WarmupFrames = 300;
+constexpr int WindowFrames = 500;
+constexpr int Windows = 20;
+constexpr int Attempts = 3;
+
+uint64_t threadCpuTimeNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ull + uint64_t(ts.tv_nsec);
+}
+
+// Fixed mix of integer, float and table work, similar in kind to a frame.
+volatile uint32_t referenceSink;
+
+uint64_t runReference() {
+    static float table[1024];
+    uint64_t start = threadCpuTimeNs();
+    uint32_t state = 1;
+    float sum = 0.f;
+    for (int i = 0; i < 20000; ++i) {
+        state = state * 1664525u + 1013904223u;
+        int index = state >> 22;
+        table[index] = table[index] * 0.5f + float(state >> 16) * (1.f / 65536.f);
+        sum += table[(index * 7) & 1023];
+    }
+    referenceSink = state + uint32_t(sum);
+    return threadCpuTimeNs() - start;
+}
+
+// Runs engine frames and returns their cost in ns. The simulator step around
+// each frame is cheap and the same in all scenarios.
+uint64_t runFrames(EngineTestFixture &fixture, int frames) {
+    uint64_t start = threadCpuTimeNs();
+    fixture.advance(frames);
+    return threadCpuTimeNs() - start;
+}
+
+typedef void (*Setup)(EngineTestFixture &fixture);
+
+void startScenario(EngineTestFixture &fixture, Setup setup) {
+    setup(fixture);
+    fixture.advance(1);
+    fixture.start();
+    runFrames(fixture, WarmupFrames);
+}
+
+// cost of one engine frame in reference units (cheapest windows)
+double measureFrameCost(Setup setup) {
+    EngineTestFixture fixture(true);
+    startScenario(fixture, setup);
+    uint64_t reference = ~uint64_t(0);
+    uint64_t frames = ~uint64_t(0);
+    for (int window = 0; window < Windows; ++window) {
+        reference = std::min(reference, runReference());
+        frames = std::min(frames, runFrames(fixture, WindowFrames));
+    }
+    return double(frames) / WindowFrames / double(reference);
+}
+
+// note tracks with default sequences
+void setupNoteDefault(EngineTestFixture &fixture) {
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        fixture.project().setTrackMode(trackIndex, Track::TrackMode::Note);
+    }
+}
+
+// every step of every track gated with the maximum number of retriggers
+void setupNoteRetrigger(EngineTestFixture &fixture, int trackIndex) {
+    fixture.project().setTrackMode(trackIndex, Track::TrackMode::Note);
+    auto &sequence = fixture.project().track(trackIndex).noteTrack().sequence(0);
+    sequence.setDivisor(1);
+    sequence.setFirstStep(0);
+    sequence.setLastStep(CONFIG_STEP_COUNT - 1);
+    for (int stepIndex = 0; stepIndex < CONFIG_STEP_COUNT; ++stepIndex) {
+        auto &step = sequence.step(stepIndex);
+        step.setGate(true);
+        step.setRetrigger(NoteSequence::Retrigger::Max);
+        step.setRetriggerProbability(NoteSequence::RetriggerProbability::Max);
+        step.setLength(NoteSequence::Length::Max);
+        step.setNote(stepIndex * 5 - 40);
+    }
+}
+
+void setupNoteRetrigger(EngineTestFixture &fixture) {
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        setupNoteRetrigger(fixture, trackIndex);
+    }
+}
+
+// fractal track recording a busy note track into all cells, with all branches
+void setupFractalMaxCells(EngineTestFixture &fixture, int trackIndex, int sourceTrack) {
+    fixture.project().setTrackMode(trackIndex, Track::TrackMode::Fractal);
+    auto &track = fixture.project().track(trackIndex).fractalTrack();
+    track.setBufferLength(CONFIG_FRACTAL_MAX_CELLS);
+    track.setSourceA(sourceTrack);
+    auto &sequence = track.sequence(0);
+    sequence.setDivisor(1);
+    sequence.setLoopFirst(0);
+    sequence.setLoopLast(CONFIG_FRACTAL_MAX_CELLS - 1);
+    sequence.setRecordFirst(0);
+    sequence.setRecordLast(CONFIG_FRACTAL_MAX_CELLS - 1);
+    sequence.setOrnFirst(0);
+    sequence.setOrnLast(CONFIG_FRACTAL_MAX_CELLS - 1);
+    sequence.setOrderMode(FractalSequence::OrderMode::Random);
+    sequence.setCaptureCadence(FractalSequence::CaptureCadence::Event);
+    sequence.setBranchCount(7);
+    sequence.setBranchPool(255);
+    sequence.setOrnamentRate(100);
+    sequence.setOrnamentIntensity(100);
+}
+
+void setupFractalMaxCells(EngineTestFixture &fixture) {
+    setupNoteRetrigger(fixture, 0);
+    for (int trackIndex = 1; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        setupFractalMaxCells(fixture, trackIndex, 0);
+    }
+}
+
+// TT2 command from its tokens in text order (as the parser emits them)
+struct Token {
+    tele_word_t tag;
+    int16_t value;
+};
+
+TT2Command command(std::initializer_list<Token> tokens) {
+    TT2Command result = {};
+    for (const auto &token : tokens) {
+        result.tag[result.length] = uint8_t(token.tag);
+        result.value[result.length] = token.value;
+        ++result.length;
+    }
+    return result;
+}
+
+// metro script runs every 2ms and keeps the delay queue full
+void setupTeletypeDelays(EngineTestFixture &fixture, int trackIndex) {
+    fixture.project().setTrackMode(trackIndex, Track::TrackMode::TeletypeV2);
+    auto &tt2Track = fixture.project().track(trackIndex).tt2Track();
+    auto &script = tt2Track.program().scripts[TT2_METRO_SCRIPT];
+    // DEL 500: TR.P 1
+    script.commands[0] = command({ { MOD, E_MOD_DEL }, { NUMBER, 500 }, { PRE_SEP, 0 }, { OP, E_OP_TR_P }, { NUMBER, 1 } });
+    // DEL 400: CV 1 RAND 16383
+    script.commands[1] = command({ { MOD, E_MOD_DEL }, { NUMBER, 400 }, { PRE_SEP, 0 }, { OP, E_OP_CV }, { NUMBER, 1 }, { OP, E_OP_RAND }, { NUMBER, 16383 } });
+    // DEL 300: TR.P 2
+    script.commands[2] = command({ { MOD, E_MOD_DEL }, { NUMBER, 300 }, { PRE_SEP, 0 }, { OP, E_OP_TR_P }, { NUMBER, 2 } });
+    // DEL 200: CV 2 RAND 16383
+    script.commands[3] = command({ { MOD, E_MOD_DEL }, { NUMBER, 200 }, { PRE_SEP, 0 }, { OP, E_OP_CV }, { NUMBER, 2 }, { OP, E_OP_RAND }, { NUMBER, 16383 } });
+    // L 1 8: A + A 1
+    script.commands[4] = command({ { MOD, E_MOD_L }, { NUMBER, 1 }, { NUMBER, 8 }, { PRE_SEP, 0 }, { OP, E_OP_A }, { OP, E_OP_ADD }, { OP, E_OP_A }, { NUMBER, 1 } });
+    // CV 3 RAND 16383
+    script.commands[5] = command({ { OP, E_OP_CV }, { NUMBER, 3 }, { OP, E_OP_RAND }, { NUMBER, 16383 } });
+    script.length = 6;
+    tt2Track.runtime().variables.m = 2;
+    tt2Track.runtime().variables.m_act = 1;
+}
+
+void setupTeletypeDelays(EngineTestFixture &fixture) {
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        setupTeletypeDelays(fixture, trackIndex);
+    }
+}
+
+// all routes active, driven by modulators into per-track targets through shapers
+void setupRoutes(EngineTestFixture &fixture) {
+    static const Routing::Target targets[] = {
+        Routing::Target::Transpose, Routing::Target::Octave, Routing::Target::Offset,
+        Routing::Target::GateProbabilityBias, Routing::Target::RetriggerProbabilityBias,
+        Routing::Target::LengthBias, Routing::Target::NoteProbabilityBias, Routing::Target::SlideTime,
+    };
+    for (int routeIndex = 0; routeIndex < CONFIG_ROUTE_COUNT; ++routeIndex) {
+        auto &route = fixture.project().routing().route(routeIndex);
+        route.setSource(Routing::Source(int(Routing::Source::Mod1) + routeIndex % CONFIG_MODULATOR_COUNT));
+        route.setTarget(targets[routeIndex % 8]);
+        route.setTracks(0xff);
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            route.setDepthPct(trackIndex, 100);
+            route.setShaper(trackIndex, Routing::Shaper(1 + (routeIndex + trackIndex) % 4));
+        }
+    }
+}
+
+void setupChaosModulators(EngineTestFixture &fixture) {
+    for (int modulatorIndex = 0; modulatorIndex < CONFIG_MODULATOR_COUNT; ++modulatorIndex) {
+        auto &modulator = fixture.project().modulator(modulatorIndex);
+        modulator.setShape(modulatorIndex % 2 ? Modulator::Shape::ChaosLatoocarfian : Modulator::Shape::ChaosLorenz);
+        modulator.setRate(1600);
+        modulator.setDepth(127);
+    }
+}
+
+void setupRoutedModulators(EngineTestFixture &fixture) {
+    setupNoteRetrigger(fixture);
+    setupChaosModulators(fixture);
+    setupRoutes(fixture);
+}
+
+// everything at once
+void setupCombined(EngineTestFixture &fixture) {
+    setupNoteRetrigger(fixture, 0);
+    setupNoteRetrigger(fixture, 1);
+    setupFractalMaxCells(fixture, 2, 0);
+    setupFractalMaxCells(fixture, 3, 1);
+    setupTeletypeDelays(fixture, 4);
+    setupTeletypeDelays(fixture, 5);
+    fixture.project().setTrackMode(6, Track::TrackMode::Stochastic);
+    fixture.project().setTrackMode(7, Track::TrackMode::PhaseFlux);
+    setupChaosModulators(fixture);
+    setupRoutes(fixture);
+}
+
+struct Scenario {
+    const char *name;
+    Setup setup;
+    // cost in reference units
+    double budget;
+    double unoptimizedBudget;
+};
+
+const Scenario scenarios[] = {
+    { "note default",       setupNoteDefault,       0.045,  0.21 },
+    { "note retrigger",     setupNoteRetrigger,     0.055,  0.26 },
+    { "fractal max cells",  setupFractalMaxCells,   0.045,  0.2  },
+    { "tt2 delay queue",    setupTeletypeDelays,    0.2,    0.54 },
+    { "routed modulators",  setupRoutedModulators,  0.3,    1.3  },
+    { "combined",           setupCombined,          0.16,   0.6  },
+};
+
+} // namespace
+
+UNIT_TEST("EngineWcet") {
+
+CASE("tt2 scenario fills the delay queue") {
+    EngineTestFixture fixture(true);
+    startScenario(fixture, setupTeletypeDelays);
+    for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        expectEqual(int(fixture.project().track(trackIndex).tt2Track().runtime().delay.count), TT2_DELAY_DEPTH);
+    }
+}
+
+CASE("scenarios stay within their frame budgets") {
+    for (const auto &scenario : scenarios) {
+#ifdef __OPTIMIZE__
+        double budget = scenario.budget;
+#else
+        double budget = scenario.unoptimizedBudget;
+#endif
+        // a loaded host can slow down a whole measurement, a regression fails every attempt
+        double cost = measureFrameCost(scenario.setup);
+        for (int attempt = 1; attempt < Attempts && cost > budget; ++attempt) {
+            cost = std::min(cost, measureFrameCost(scenario.setup));
+        }
+        std::printf("  %-20s %6.3f (budget %6.3f)\n", scenario.name, cost, budget);
+        expectTrue(cost <= budget, scenario.name);
+    }
+}
+
+}
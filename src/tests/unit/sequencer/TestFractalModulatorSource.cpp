@@ -0,0 +1,93 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/FractalTrackEngine.h"
+#include "apps/sequencer/model/FractalTrack.h"
+#include "apps/sequencer/model/Modulator.h"
+#include "apps/sequencer/Config.h"
+
+#include <vector>
+
+// A fractal track reading a modulator channel samples it on every tick, so the
+// engine must not batch that modulator across the ticks of a frame. The run is
+// compared against one where a second modulator gated by Mod1 forces Mod1 to be
+// evaluated on every tick.
+
+namespace {
+
+struct Capture {
+    std::vector<uint16_t> trunk;
+    std::vector<float> cv;
+};
+
+Capture run(bool forcePerTick) {
+    EngineTestFixture fixture(true);
+    auto &project = fixture.project();
+    project.setTempo(1000.f);   // several ticks per frame
+    // teletype tracks disable batching altogether, keep them out of the default project
+    for (int trackIndex = 1; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        project.setTrackMode(trackIndex, Track::TrackMode::Note);
+    }
+
+    auto &modulator = project.modulator(0);
+    modulator.setShape(Modulator::Shape::Sine);
+    modulator.setMode(Modulator::Mode::Run);
+    modulator.setRateDomain(Modulator::RateDomain::Tempo);
+    modulator.setRate(48);
+    if (forcePerTick) {
+        project.modulator(1).setGateSource(Routing::Source::Mod1);
+    }
+
+    project.setTrackMode(0, Track::TrackMode::Fractal);
+    auto &track = project.track(0).fractalTrack();
+    track.setBufferLength(CONFIG_FRACTAL_MAX_CELLS);
+    track.setSourceA(CONFIG_TRACK_COUNT + 24);   // Mod1 in the channel list
+    auto &sequence = track.sequence(0);
+    sequence.setDivisor(48);
+    sequence.setLoopFirst(0);
+    sequence.setLoopLast(CONFIG_FRACTAL_MAX_CELLS - 1);
+    sequence.setRecordFirst(0);
+    sequence.setRecordLast(CONFIG_FRACTAL_MAX_CELLS - 1);
+    sequence.setCaptureCadence(FractalSequence::CaptureCadence::Event);
+    sequence.setRecordTrigger(1);
+
+    Capture capture;
+    auto &engine = fixture.engine();
+    fixture.setUpdateHooks(nullptr, [&] { capture.cv.push_back(engine.trackEngine(0).cvOutput(0)); });
+    fixture.start();
+    fixture.advance(500);
+
+    const auto &fractalEngine = engine.trackEngine(0).as<FractalTrackEngine>();
+    for (int i = 0; i < CONFIG_FRACTAL_MAX_CELLS; ++i) {
+        capture.trunk.push_back(fractalEngine.trunkCellForTest(i));
+    }
+    return capture;
+}
+
+} // namespace
+
+UNIT_TEST("FractalModulatorSource") {
+
+CASE("modulator source is sampled on every tick") {
+    auto batched = run(false);
+    auto reference = run(true);
+
+    int recorded = 0;
+    int trunkMismatches = 0;
+    for (size_t i = 0; i < reference.trunk.size(); ++i) {
+        recorded += (reference.trunk[i] & 0x8000) ? 1 : 0;
+        trunkMismatches += batched.trunk[i] != reference.trunk[i] ? 1 : 0;
+    }
+    int cvMismatches = 0;
+    expectEqual(batched.cv.size(), reference.cv.size(), "frame count");
+    for (size_t i = 0; i < reference.cv.size() && i < batched.cv.size(); ++i) {
+        cvMismatches += batched.cv[i] != reference.cv[i] ? 1 : 0;
+    }
+
+    expectTrue(recorded > 8, "fractal track records from the modulator");
+    expectEqual(trunkMismatches, 0, "recorded cells match per-tick sampling");
+    expectEqual(cvMismatches, 0, "cv output matches per-tick sampling");
+}
+
+}
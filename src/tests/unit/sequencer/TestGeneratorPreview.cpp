@@ -0,0 +1,103 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/generators/SequenceBuilder.h"
+#include "apps/sequencer/engine/generators/RandomGenerator.h"
+#include "apps/sequencer/engine/generators/EuclideanGenerator.h"
+#include "apps/sequencer/model/NoteSequence.h"
+
+static bool sameValues(const SequenceBuilder &a, const SequenceBuilder &b) {
+    for (int i = 0; i < a.capacity(); ++i) {
+        if (a.value(i) != b.value(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+UNIT_TEST("GeneratorPreview") {
+
+CASE("random incremental update matches full generation") {
+    NoteSequence sequence;
+    NoteSequenceBuilder builder(sequence, NoteSequence::Layer::Note);
+    RandomGenerator::Params params;
+    RandomGenerator generator(builder, params);
+
+    generator.setSeed(1234);
+    generator.update();
+    generator.setSmooth(3);
+    generator.update();
+    generator.setBias(4);
+    generator.update();
+    generator.setScale(30);
+    generator.update();
+    generator.setVariation(60);
+    generator.update();
+
+    NoteSequence freshSequence;
+    NoteSequenceBuilder freshBuilder(freshSequence, NoteSequence::Layer::Note);
+    RandomGenerator::Params freshParams = params;
+    RandomGenerator fresh(freshBuilder, freshParams);
+
+    expectTrue(sameValues(builder, freshBuilder), "incremental values match");
+}
+
+CASE("generator rewrites all steps after the edit sequence is replaced") {
+    NoteSequence sequence;
+    NoteSequenceBuilder builder(sequence, NoteSequence::Layer::Gate);
+    EuclideanGenerator::Params params;
+    EuclideanGenerator generator(builder, params);
+    builder.updatePreview();
+    builder.showPreview();
+
+    // same parameters, but the edit sequence now holds the original
+    builder.showOriginal();
+    generator.update();
+    builder.updatePreview();
+    builder.showPreview();
+
+    NoteSequence freshSequence;
+    NoteSequenceBuilder freshBuilder(freshSequence, NoteSequence::Layer::Gate);
+    EuclideanGenerator::Params freshParams = params;
+    EuclideanGenerator fresh(freshBuilder, freshParams);
+
+    expectTrue(sameValues(builder, freshBuilder), "euclidean values rewritten");
+}
+
+CASE("preview toggles and applies") {
+    NoteSequence sequence;
+    NoteSequenceBuilder builder(sequence, NoteSequence::Layer::Gate);
+    EuclideanGenerator::Params params;
+    params.beats = 3;
+    params.steps = 8;
+    EuclideanGenerator generator(builder, params);
+    builder.updatePreview();
+    builder.showPreview();
+    expectTrue(builder.showingPreview());
+
+    NoteSequence preview = sequence;
+
+    builder.showOriginal();
+    expectFalse(builder.showingPreview());
+    expectFalse(sequence.step(0).gate());
+
+    builder.showPreview();
+    expectTrue(builder.showingPreview());
+    for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+        expectEqual(sequence.step(i).gate(), preview.step(i).gate());
+    }
+
+    builder.showOriginal();
+    builder.apply();
+    expectTrue(builder.showingPreview());
+    for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+        expectEqual(sequence.step(i).gate(), preview.step(i).gate());
+        expectEqual(builder.originalValue(i), builder.value(i));
+    }
+
+    builder.revert();
+    for (int i = 0; i < CONFIG_STEP_COUNT; ++i) {
+        expectEqual(sequence.step(i).gate(), preview.step(i).gate());
+    }
+}
+
+}
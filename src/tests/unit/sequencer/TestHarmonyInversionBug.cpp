@@ -355,4 +355,26 @@ CASE("fix_preserves_per_step_override_behavior") {
     expectEqual(effective3, 2, "step 3: uses per-step override (2)");
 }
 
+CASE("inversion_table_lookup_matches_reference") {
+    // Roots at the MIDI range limits clamp per pipeline step, the table
+    // lookup must still agree with the reference for every inversion
+    static const int roots[] = { 0, 5, 11, 12, 60, 92, 93, 120, 127 };
+    HarmonyEngine engine;
+    engine.setMode(HarmonyEngine::Ionian);
+
+    for (int inversion = 0; inversion < 4; ++inversion) {
+        engine.setInversion(inversion);
+        for (int root : roots) {
+            for (int degree = 0; degree < 7; ++degree) {
+                auto chord = engine.harmonize(root, degree);
+                auto reference = engine.harmonizeReference(root, degree);
+                expectEqual(int(chord.root), int(reference.root), "root matches reference");
+                expectEqual(int(chord.third), int(reference.third), "third matches reference");
+                expectEqual(int(chord.fifth), int(reference.fifth), "fifth matches reference");
+                expectEqual(int(chord.seventh), int(reference.seventh), "seventh matches reference");
+            }
+        }
+    }
+}
+
 } // UNIT_TEST("Harmony Inversion Bug")
@@ -373,4 +373,42 @@ CASE("each_voicing_has_unique_bass_note") {
     expectEqual(spreadLowest, 60, "spread lowest should be root (60)");
 }
 
+// =============================================================================
+// SECTION: Voicing Table Equivalence
+// =============================================================================
+
+// harmonize() reads precomputed voice offsets, it must match the step-by-step
+// pipeline for every mode, degree, inversion, voicing, transpose and root
+
+CASE("voicing_table_matches_reference_pipeline") {
+    static const int transposes[] = { -24, -13, -7, 0, 5, 12, 24 };
+    HarmonyEngine engine;
+    int mismatches = 0;
+
+    for (int mode = 0; mode < 7; ++mode) {
+        engine.setMode(HarmonyEngine::Mode(mode));
+        for (int inversion = 0; inversion < 4; ++inversion) {
+            engine.setInversion(inversion);
+            for (int voicing = 0; voicing < 4; ++voicing) {
+                engine.setVoicing(HarmonyEngine::Voicing(voicing));
+                for (int transpose : transposes) {
+                    engine.setTranspose(transpose);
+                    for (int degree = 0; degree < 7; ++degree) {
+                        for (int root = 0; root <= 127; ++root) {
+                            auto chord = engine.harmonize(root, degree);
+                            auto reference = engine.harmonizeReference(root, degree);
+                            if (chord.root != reference.root || chord.third != reference.third ||
+                                chord.fifth != reference.fifth || chord.seventh != reference.seventh) {
+                                ++mismatches;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    expectEqual(mismatches, 0, "table lookup matches reference pipeline");
+}
+
 } // UNIT_TEST("Harmony Voicing")
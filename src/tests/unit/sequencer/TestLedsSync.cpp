@@ -0,0 +1,83 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/ui/Leds.h"
+
+#include "core/utils/Random.h"
+
+// Leds::sync() hands only changed LEDs to the driver. Applying the changes to
+// a driver image must always give the same image as copying the full frame.
+
+static Leds::LedArray applySync(Leds &leds, Leds::LedArray &image, int &changed) {
+    changed = leds.sync([&] (int index, uint8_t red, uint8_t green) {
+        image[index] = { red, green };
+    });
+    return image;
+}
+
+UNIT_TEST("LedsSync") {
+
+CASE("first sync of a dark frame changes nothing") {
+    Leds leds;
+    leds.clear();
+    Leds::LedArray image;
+    image.fill({ 0, 0 });
+    int changed;
+    applySync(leds, image, changed);
+    expectEqual(changed, 0);
+}
+
+CASE("steady frame is synced once") {
+    Leds leds;
+    Leds::LedArray image;
+    image.fill({ 0, 0 });
+    int changed;
+
+    leds.clear();
+    leds.set(3, true, false);
+    leds.setDimmed(7, 0x80, 0x40);
+    applySync(leds, image, changed);
+    expectEqual(changed, 2);
+    expectTrue(image == leds.array());
+
+    for (int frame = 0; frame < 4; ++frame) {
+        leds.clear();
+        leds.set(3, true, false);
+        leds.setDimmed(7, 0x80, 0x40);
+        applySync(leds, image, changed);
+        expectEqual(changed, 0);
+    }
+
+    leds.clear();
+    leds.set(3, true, false);
+    applySync(leds, image, changed);
+    expectEqual(changed, 1);
+    expectTrue(image == leds.array());
+}
+
+CASE("random frames give identical images") {
+    Leds leds;
+    Leds::LedArray image;
+    image.fill({ 0, 0 });
+    Random rng(1234);
+    int size = int(leds.array().size());
+
+    for (int frame = 0; frame < 1000; ++frame) {
+        leds.clear();
+        int count = rng.nextRange(size);
+        for (int i = 0; i < count; ++i) {
+            int index = rng.nextRange(size);
+            if (rng.nextRange(4) == 0) {
+                leds.mask(index);
+            } else if (rng.nextRange(2) == 0) {
+                leds.set(index, rng.nextRange(2), rng.nextRange(2));
+            } else {
+                leds.setDimmed(index, rng.nextRange(256), rng.nextRange(256));
+            }
+        }
+        int changed;
+        applySync(leds, image, changed);
+        expectTrue(image == leds.array());
+    }
+}
+
+}
@@ -0,0 +1,177 @@
+#include "UnitTest.h"
+
+#include "ui/model/CurveSequenceListModel.h"
+#include "ui/model/CurveTrackListModel.h"
+#include "ui/model/DiscreteMapSequenceListModel.h"
+#include "ui/model/DiscreteMapTrackListModel.h"
+#include "ui/model/FractalSequenceListModel.h"
+#include "ui/model/FractalTrackListModel.h"
+#include "ui/model/IndexedSequenceListModel.h"
+#include "ui/model/IndexedTrackListModel.h"
+#include "ui/model/MidiCvTrackListModel.h"
+#include "ui/model/NoteSequenceListModel.h"
+#include "ui/model/NoteTrackListModel.h"
+#include "ui/model/PhaseFluxSequenceListModel.h"
+#include "ui/model/PhaseFluxTrackListModel.h"
+#include "ui/model/ProjectListModel.h"
+#include "ui/model/StochasticConfigListModel.h"
+#include "ui/model/StochasticPerformanceListModel.h"
+#include "ui/model/TuesdaySequenceListModel.h"
+#include "ui/model/TuesdayTrackListModel.h"
+
+#include "model/Project.h"
+
+#include "core/utils/StringBuilder.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+
+// ListPage re-formats a cell only when its revision changes, so the revision
+// has to change whenever the cell text does.
+
+namespace {
+
+// Edits every row up and down, with and without its route, and expects equal
+// revisions of a cell to always come with equal text.
+void expectRevisionsDetermineText(ListModel &model, int trackIndex) {
+    for (int row = 0; row < model.rows(); ++row) {
+        Routing::Target target = model.routingTarget(row);
+        std::map<uint64_t, std::string> texts[2];
+
+        for (int step = 0; step < 24; ++step) {
+            if (target != Routing::Target::None) {
+                Routing::setRouted(target, 1 << trackIndex, step >= 12);
+            }
+            for (int column = 0; column < 2; ++column) {
+                uint64_t revision;
+                if (!model.cellRevision(row, column, revision)) {
+                    continue;
+                }
+                FixedStringBuilder<32> text;
+                model.cell(row, column, text);
+                auto it = texts[column].find(revision);
+                if (it == texts[column].end()) {
+                    texts[column].emplace(revision, std::string(text));
+                } else if (it->second != std::string(text)) {
+                    expectTrue(false, "text changed without a revision change");
+                }
+            }
+            int value = (step % 12) < 6 ? 1 : -1;
+            model.edit(row, 1, value, step % 3 == 0);
+        }
+
+        if (target != Routing::Target::None) {
+            Routing::setRouted(target, 1 << trackIndex, false);
+        }
+    }
+}
+
+} // namespace
+
+UNIT_TEST("ListModelRevision") {
+
+CASE("note track cell revision follows the value") {
+    NoteTrack track;
+    track.clear();
+    NoteTrackListModel model;
+    model.setTrack(track);
+
+    for (int row = 0; row < model.rows(); ++row) {
+        uint64_t nameRevision;
+        expectTrue(model.cellRevision(row, 0, nameRevision));
+
+        uint64_t before, after;
+        FixedStringBuilder<32> textBefore, textAfter;
+        expectTrue(model.cellRevision(row, 1, before));
+        model.cell(row, 1, textBefore);
+
+        model.edit(row, 1, 1, false);
+
+        expectTrue(model.cellRevision(row, 1, after));
+        model.cell(row, 1, textAfter);
+        if (std::strcmp(textBefore, textAfter) != 0) {
+            expectTrue(before != after, "text changed without a revision change");
+        }
+    }
+}
+
+CASE("routable list model revisions determine the text") {
+    Project project;
+    const int trackIndex = 0;
+    auto &track = project.track(trackIndex);
+
+    ProjectListModel projectModel(project);
+    expectRevisionsDetermineText(projectModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Note);
+    NoteTrackListModel noteTrackModel;
+    noteTrackModel.setTrack(track.noteTrack());
+    expectRevisionsDetermineText(noteTrackModel, trackIndex);
+    NoteSequenceListModel noteSequenceModel;
+    noteSequenceModel.setSequence(&track.noteTrack().sequence(0));
+    expectRevisionsDetermineText(noteSequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Curve);
+    CurveTrackListModel curveTrackModel;
+    curveTrackModel.setTrack(track.curveTrack());
+    expectRevisionsDetermineText(curveTrackModel, trackIndex);
+    CurveSequenceListModel curveSequenceModel;
+    curveSequenceModel.setSequence(&track.curveTrack().sequence(0));
+    expectRevisionsDetermineText(curveSequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::MidiCv);
+    MidiCvTrackListModel midiCvTrackModel;
+    midiCvTrackModel.setTrack(track.midiCvTrack());
+    expectRevisionsDetermineText(midiCvTrackModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Tuesday);
+    TuesdayTrackListModel tuesdayTrackModel;
+    tuesdayTrackModel.setTrack(&track.tuesdayTrack());
+    expectRevisionsDetermineText(tuesdayTrackModel, trackIndex);
+    TuesdaySequenceListModel tuesdaySequenceModel;
+    tuesdaySequenceModel.setSequence(&track.tuesdayTrack().sequence(0));
+    expectRevisionsDetermineText(tuesdaySequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::DiscreteMap);
+    DiscreteMapTrackListModel discreteMapTrackModel;
+    discreteMapTrackModel.setTrack(&track.discreteMapTrack());
+    expectRevisionsDetermineText(discreteMapTrackModel, trackIndex);
+    DiscreteMapSequenceListModel discreteMapSequenceModel;
+    discreteMapSequenceModel.setSequence(&track.discreteMapTrack().sequence(0));
+    expectRevisionsDetermineText(discreteMapSequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Indexed);
+    IndexedTrackListModel indexedTrackModel;
+    indexedTrackModel.setTrack(&track.indexedTrack());
+    expectRevisionsDetermineText(indexedTrackModel, trackIndex);
+    IndexedSequenceListModel indexedSequenceModel;
+    indexedSequenceModel.setSequence(&track.indexedTrack().sequence(0));
+    expectRevisionsDetermineText(indexedSequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Stochastic);
+    StochasticConfigListModel stochasticConfigModel;
+    stochasticConfigModel.setTrack(track.stochasticTrack(), project);
+    expectRevisionsDetermineText(stochasticConfigModel, trackIndex);
+    StochasticPerformanceListModel stochasticPerformanceModel;
+    stochasticPerformanceModel.setTrack(track.stochasticTrack(), project);
+    expectRevisionsDetermineText(stochasticPerformanceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::Fractal);
+    FractalTrackListModel fractalTrackModel;
+    fractalTrackModel.setTrack(track.fractalTrack());
+    expectRevisionsDetermineText(fractalTrackModel, trackIndex);
+    FractalSequenceListModel fractalSequenceModel;
+    fractalSequenceModel.setSequence(&track.fractalTrack().sequence(0));
+    expectRevisionsDetermineText(fractalSequenceModel, trackIndex);
+
+    project.setTrackMode(trackIndex, Track::TrackMode::PhaseFlux);
+    PhaseFluxTrackListModel phaseFluxTrackModel;
+    phaseFluxTrackModel.setTrack(&track.phaseFluxTrack());
+    expectRevisionsDetermineText(phaseFluxTrackModel, trackIndex);
+    PhaseFluxSequenceListModel phaseFluxSequenceModel;
+    phaseFluxSequenceModel.setSequence(&track.phaseFluxTrack().sequence(0));
+    expectRevisionsDetermineText(phaseFluxSequenceModel, trackIndex);
+}
+
+}
@@ -0,0 +1,88 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/ModulatorEngine.h"
+#include "apps/sequencer/model/Modulator.h"
+
+#include "core/utils/Random.h"
+
+// ModulatorEngine::advance(n) must match n calls to tick() with the same gate,
+// for every shape, mode and rate domain.
+
+static bool matches(const ModulatorEngine &a, const ModulatorEngine &b, int index) {
+    return a.currentValue(index) == b.currentValue(index) &&
+           a.currentPhase(index) == b.currentPhase(index) &&
+           a.adsrState(index) == b.adsrState(index) &&
+           a.adsrTimer(index) == b.adsrTimer(index);
+}
+
+UNIT_TEST("ModulatorAdvance") {
+
+CASE("advance matches ticking every tick") {
+    static const int rates[] = { 6, 48, 192, 1000 };
+    static const int times[] = { 0, 5, 40, 300, 2000 };
+    const float dt = 0.001f;
+    int mismatches = 0;
+    int batches = 0;
+
+    for (int shape = 0; shape < int(Modulator::Shape::Last); ++shape) {
+        for (int mode = 0; mode < int(Modulator::Mode::Last); ++mode) {
+            for (int domain = 0; domain < int(Modulator::RateDomain::Last); ++domain) {
+                for (int variant = 0; variant < 4; ++variant) {
+                    Modulator modulator;
+                    modulator.setShape(Modulator::Shape(shape));
+                    modulator.setMode(Modulator::Mode(mode));
+                    modulator.setRateDomain(Modulator::RateDomain(domain));
+                    modulator.setRate(domain == int(Modulator::RateDomain::Free) ? 50 + variant * 400 : rates[variant]);
+                    modulator.setAttack(times[variant]);
+                    modulator.setDecay(times[(variant + 2) % 5]);
+                    modulator.setSustain(variant * 40);
+                    modulator.setRelease(times[(variant + 3) % 5]);
+                    modulator.setSmooth(variant * 50);
+                    modulator.setPhase(variant * 45);
+
+                    for (int index = 0; index < 2; ++index) {
+                        ModulatorEngine reference;
+                        ModulatorEngine batched;
+                        reference.reset();
+                        batched.reset();
+
+                        Random rng(shape * 1000 + mode * 100 + domain * 10 + variant);
+                        uint32_t tick = 0;
+                        bool gate = false;
+                        for (int batch = 0; batch < 200; ++batch) {
+                            if (rng.nextRange(3) == 0) {
+                                gate = !gate;
+                            }
+                            uint32_t length = 1 + rng.nextRange(batch % 5 == 0 ? 400 : 12);
+                            for (uint32_t i = 0; i < length; ++i) {
+                                reference.tick(tick++, dt, modulator, index, gate);
+                            }
+                            batched.advance(length, dt, modulator, index, gate);
+                            if (!matches(reference, batched, index)) {
+                                ++mismatches;
+                            }
+                            ++batches;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    expectEqual(mismatches, 0);
+    expectTrue(batches > 0);
+}
+
+CASE("zero ticks leave the state unchanged") {
+    Modulator modulator;
+    modulator.setShape(Modulator::Shape::ADSR);
+    ModulatorEngine engine;
+    engine.reset();
+    engine.tick(0, 0.001f, modulator, 0, true);
+    int value = engine.currentValue(0);
+    engine.advance(0, 0.001f, modulator, 0, false);
+    expectEqual(engine.currentValue(0), value);
+    expectTrue(engine.adsrState(0) != ModulatorEngine::ADSRState::Release);
+}
+
+}
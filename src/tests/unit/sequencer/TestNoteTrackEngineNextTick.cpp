@@ -0,0 +1,84 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/NoteTrackEngine.h"
+
+// NoteTrackEngine::nextTick() lets the engine skip ticks on which a track has
+// nothing to do. An engine only ticked on the reported ticks must produce the
+// same outputs as one ticked on every tick.
+
+static void setupSequence(NoteSequence &sequence, int variant) {
+    static const int divisors[] = { 1, 3, 6, 12, 7, 24 };
+    static const int multipliers[] = { 100, 50, 150, 200, 73 };
+    sequence.clear();
+    sequence.setDivisor(divisors[variant % 6]);
+    sequence.setClockMultiplier(multipliers[variant % 5]);
+    sequence.setResetMeasure(variant % 3);
+    sequence.setMode(variant % 4 == 3 ? NoteSequence::Mode::Ikra : NoteSequence::Mode::Linear);
+    sequence.setDivisorY(divisors[(variant + 2) % 6]);
+    sequence.setLastStep(5 + variant % 11);
+    for (int i = 0; i < 16; ++i) {
+        auto &step = sequence.step(i);
+        step.setGate((i + variant) % 3 != 0);
+        step.setNote(i * 3 - 7);
+        step.setLength((i * 5 + variant) % 8);
+        step.setGateOffset((i + variant) % 5 - 2);
+        step.setRetrigger((i + variant) % 4);
+        step.setSlide(i % 5 == 0);
+        step.setPulseCount((i + variant) % 3);
+    }
+}
+
+UNIT_TEST("NoteTrackEngineNextTick") {
+
+CASE("free mode runs every tick") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    auto &track = fixture.project().track(0);
+    track.noteTrack().setPlayMode(Types::PlayMode::Free);
+    NoteTrackEngine trackEngine(fixture.engine(), fixture.model(), track);
+    for (uint32_t tick = 0; tick < 100; ++tick) {
+        expectEqual(trackEngine.nextTick(tick), tick);
+    }
+}
+
+CASE("aligned mode skipping matches ticking every tick") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    auto &track = fixture.project().track(0);
+    track.noteTrack().setPlayMode(Types::PlayMode::Aligned);
+    auto &sequence = track.noteTrack().sequence(0);
+
+    int mismatches = 0;
+    int skipped = 0;
+    int total = 0;
+    for (int variant = 0; variant < 20; ++variant) {
+        setupSequence(sequence, variant);
+        fixture.project().setSwing(50 + (variant % 4) * 5);
+
+        NoteTrackEngine reference(fixture.engine(), fixture.model(), track);
+        NoteTrackEngine skipping(fixture.engine(), fixture.model(), track);
+        uint32_t next = 0;
+        for (uint32_t tick = 0; tick < 5000; ++tick) {
+            reference.tick(tick);
+            if (tick >= next) {
+                skipping.tick(tick);
+                next = skipping.nextTick(tick + 1);
+                expectTrue(next > tick);
+            } else {
+                ++skipped;
+            }
+            if (reference.gateOutput(0) != skipping.gateOutput(0) ||
+                reference.cvOutput(0) != skipping.cvOutput(0) ||
+                reference.currentStep() != skipping.currentStep()) {
+                ++mismatches;
+            }
+            ++total;
+        }
+    }
+    expectEqual(mismatches, 0);
+    expectTrue(skipped > total / 2, "most ticks should be skipped");
+}
+
+}
@@ -0,0 +1,96 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/NoteTrackEngine.h"
+
+#include <vector>
+
+// Random step decisions of NoteTrackEngine come from keyed streams per
+// (track, pattern, step, pulse, iteration), so a track's output does not
+// depend on other tracks or on its own history.
+
+static void setupRandomSequence(NoteSequence &sequence) {
+    sequence.clear();
+    sequence.setDivisor(6);
+    for (int i = 0; i < 16; ++i) {
+        auto &step = sequence.step(i);
+        step.setGate(true);
+        step.setGateProbability(NoteSequence::GateProbability::Max / 2);
+        step.setNote(i);
+        step.setNoteVariationRange(7);
+        step.setNoteVariationProbability(NoteSequence::NoteVariationProbability::Max / 2);
+        step.setLength(3);
+        step.setLengthVariationRange(3);
+        step.setLengthVariationProbability(NoteSequence::LengthVariationProbability::Max / 2);
+        step.setRetrigger(2);
+        step.setRetriggerProbability(NoteSequence::RetriggerProbability::Max / 2);
+    }
+}
+
+struct Frame {
+    bool gate;
+    float cv;
+    bool operator==(const Frame &other) const { return gate == other.gate && cv == other.cv; }
+};
+
+static std::vector<Frame> run(NoteTrackEngine &trackEngine, uint32_t ticks, NoteTrackEngine *other = nullptr) {
+    std::vector<Frame> frames;
+    for (uint32_t tick = 0; tick < ticks; ++tick) {
+        if (other) {
+            other->tick(tick);
+        }
+        trackEngine.tick(tick);
+        trackEngine.update(0.f);
+        frames.push_back({ trackEngine.gateOutput(0), trackEngine.cvOutput(0) });
+    }
+    return frames;
+}
+
+UNIT_TEST("NoteTrackEngineRng") {
+
+CASE("outputs do not depend on other tracks") {
+    EngineTestFixture fixture;
+    auto &project = fixture.project();
+    project.setTrackMode(0, Track::TrackMode::Note);
+    project.setTrackMode(1, Track::TrackMode::Note);
+    auto &track = project.track(0);
+    auto &otherTrack = project.track(1);
+    track.noteTrack().setPlayMode(Types::PlayMode::Aligned);
+    otherTrack.noteTrack().setPlayMode(Types::PlayMode::Aligned);
+    setupRandomSequence(track.noteTrack().sequence(0));
+    setupRandomSequence(otherTrack.noteTrack().sequence(0));
+
+    NoteTrackEngine alone(fixture.engine(), fixture.model(), track);
+    auto expected = run(alone, 4000);
+
+    NoteTrackEngine shared(fixture.engine(), fixture.model(), track);
+    NoteTrackEngine other(fixture.engine(), fixture.model(), otherTrack);
+    auto actual = run(shared, 4000, &other);
+
+    expectTrue(expected == actual, "track output changed when another track was ticked");
+
+    int gates = 0;
+    for (const auto &frame : expected) {
+        gates += frame.gate ? 1 : 0;
+    }
+    expectTrue(gates > 0 && gates < int(expected.size()), "expected random gates");
+}
+
+CASE("reset replays identically") {
+    EngineTestFixture fixture;
+    auto &project = fixture.project();
+    project.setTrackMode(0, Track::TrackMode::Note);
+    auto &track = project.track(0);
+    track.noteTrack().setPlayMode(Types::PlayMode::Aligned);
+    setupRandomSequence(track.noteTrack().sequence(0));
+
+    NoteTrackEngine trackEngine(fixture.engine(), fixture.model(), track);
+    auto first = run(trackEngine, 4000);
+    trackEngine.reset();
+    auto second = run(trackEngine, 4000);
+
+    expectTrue(first == second, "replay after reset diverged");
+}
+
+}
@@ -0,0 +1,43 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "sim/OutputSkewTracker.h"
+
+#include "core/profiler/TaskTelemetry.h"
+
+#include "apps/sequencer/Config.h"
+
+// The engine commits the cv frame and the gate latch together at the end of
+// each update, so every gate opening reaches the jacks with its new cv.
+UNIT_TEST("OutputCommit") {
+
+    CASE("gates latch in the same commit as their cv") {
+        EngineTestFixture fixture(true);
+        sim::OutputSkewTracker tracker(sim::Simulator::instance());
+
+        auto &project = fixture.project();
+        project.setTempo(480.f);
+        for (int trackIndex = 0; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+            project.setTrackMode(trackIndex, Track::TrackMode::Note);
+        }
+        auto &sequence = project.track(0).noteTrack().sequence(0);
+        for (int stepIndex = 0; stepIndex < 16; ++stepIndex) {
+            auto &step = sequence.step(stepIndex);
+            step.setGate(true);
+            step.setNote(stepIndex * 5 - 40);
+        }
+        fixture.advance(1);
+
+        TaskTelemetry::resetMax();
+        fixture.start();
+        fixture.advance(2000);
+
+        expectTrue(tracker.commits() >= 2000, "one gate latch per engine update");
+        expectTrue(tracker.edges() > 16, "gates open with a new cv");
+        expectEqual(tracker.maxSkew(), 0, "gates latch in the commit of their cv");
+        // both outputs are stamped by the stepped wall clock of the same update
+        expectEqual(TaskTelemetry::sample().outputSkewMax, uint32_t(0), "gate latch follows the dac update");
+    }
+
+}
@@ -0,0 +1,44 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/model/Model.h"
+
+UNIT_TEST("PatternDuplicate") {
+
+CASE("duplicates all tracks to the next pattern") {
+    Model model;
+    auto &project = model.project();
+    project.setTrackMode(0, Track::TrackMode::Note);
+    project.setTrackMode(1, Track::TrackMode::Stochastic);
+    auto &noteSequence = project.track(0).noteTrack().sequence(2);
+    noteSequence.step(3).setGate(true);
+    noteSequence.step(5).setNote(7);
+    project.track(1).stochasticTrack().sequence(2).setRhythmSeed(0xcafe);
+
+    expectTrue(project.duplicatePattern(2));
+    const auto &copy = project.track(0).noteTrack().sequence(3);
+    expectTrue(copy.step(3).gate());
+    expectEqual(copy.step(5).note(), 7);
+    expectEqual(project.track(1).stochasticTrack().sequence(3).rhythmSeed(), uint32_t(0xcafe));
+}
+
+CASE("leaves the clipboard alone") {
+    Model model;
+    auto &project = model.project();
+    project.setTrackMode(0, Track::TrackMode::Note);
+    project.track(0).noteTrack().sequence(0).step(1).setGate(true);
+    model.clipBoard().copyNoteSequence(project.track(0).noteTrack().sequence(0));
+
+    expectTrue(project.duplicatePattern(4));
+    expectTrue(model.clipBoard().canPasteNoteSequence());
+
+    NoteSequence pasted;
+    model.clipBoard().pasteNoteSequence(pasted);
+    expectTrue(pasted.step(1).gate());
+}
+
+CASE("last pattern has no next slot") {
+    Model model;
+    expectFalse(model.project().duplicatePattern(CONFIG_PATTERN_COUNT - 1));
+}
+
+}
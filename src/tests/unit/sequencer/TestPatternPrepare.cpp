@@ -0,0 +1,118 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/StochasticTrackEngine.h"
+
+// The engine prepares derived state of upcoming patterns (pattern requests, next
+// song slot) ahead of the switch. Whatever the track adopts on the switch must
+// be identical to rebuilding it from the current content.
+
+// Loop sources keep the cache in sync with the content while playing (Live
+// writes back played events and refreshes lazily).
+static void setupPattern(StochasticSequence &sequence, int variant) {
+    sequence.setRhythmMode(StochasticSourceMode::Loop);
+    sequence.setMelodyMode(StochasticSourceMode::Loop);
+    sequence.setRhythmSeed(0x1234 + variant * 0x9e37);
+    sequence.setNoteDuration(variant % 8);
+    sequence.setVariation(20 + variant * 15);
+    sequence.setBurst(variant * 20);
+}
+
+static StochasticTrackEngine &stochasticEngine(EngineTestFixture &fixture, int trackIndex) {
+    return static_cast<StochasticTrackEngine &>(fixture.engine().trackEngine(trackIndex));
+}
+
+static bool matchesRebuild(StochasticTrackEngine &trackEngine) {
+    stochastic_cache::StepCache adopted = trackEngine.stepCache();
+    trackEngine.refreshStepCacheNow();
+    const auto &rebuilt = trackEngine.stepCache();
+    if (adopted.count != rebuilt.count || adopted.cycleTicks != rebuilt.cycleTicks) {
+        return false;
+    }
+    for (int i = 0; i < adopted.count; ++i) {
+        if (adopted.runtimeSteps[i].packed != rebuilt.runtimeSteps[i].packed ||
+            adopted.aux[i].packed != rebuilt.aux[i].packed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void setupTrack(EngineTestFixture &fixture) {
+    fixture.project().setTrackMode(0, Track::TrackMode::Stochastic);
+    auto &track = fixture.project().track(0).stochasticTrack();
+    for (int pattern = 0; pattern < 4; ++pattern) {
+        setupPattern(track.sequence(pattern), pattern);
+    }
+    fixture.advance(1);
+}
+
+UNIT_TEST("PatternPrepare") {
+
+CASE("prepared cache is adopted on the pattern switch") {
+    EngineTestFixture fixture;
+    setupTrack(fixture);
+    auto &trackEngine = stochasticEngine(fixture, 0);
+
+    trackEngine.preparePattern(2);
+    fixture.project().playState().selectTrackPattern(0, 2);
+    fixture.advance(1);
+    expectEqual(trackEngine.pattern(), 2);
+    expectTrue(matchesRebuild(trackEngine));
+}
+
+CASE("stale prepared cache is not adopted") {
+    EngineTestFixture fixture;
+    setupTrack(fixture);
+    auto &trackEngine = stochasticEngine(fixture, 0);
+
+    trackEngine.preparePattern(1);
+    // edit the pattern after it was prepared
+    fixture.project().track(0).stochasticTrack().sequence(1).setRhythmSeed(0xdeadbeef);
+    fixture.project().track(0).stochasticTrack().sequence(1).setNoteDuration(7);
+    fixture.project().playState().selectTrackPattern(0, 1);
+    fixture.advance(1);
+    expectEqual(trackEngine.pattern(), 1);
+    expectTrue(matchesRebuild(trackEngine));
+}
+
+CASE("synced pattern request while playing") {
+    EngineTestFixture fixture;
+    setupTrack(fixture);
+    auto &trackEngine = stochasticEngine(fixture, 0);
+
+    fixture.start();
+    fixture.advance(100);
+    fixture.project().playState().selectTrackPattern(0, 3, PlayState::Synced);
+    fixture.advance(5000);
+    expectEqual(trackEngine.pattern(), 3);
+    expectTrue(matchesRebuild(trackEngine));
+}
+
+CASE("song slots advance with prepared patterns") {
+    EngineTestFixture fixture;
+    setupTrack(fixture);
+    auto &trackEngine = stochasticEngine(fixture, 0);
+    auto &song = fixture.project().song();
+    for (int slot = 0; slot < 3; ++slot) {
+        song.insertSlot(slot);
+        song.setPattern(slot, 0, slot + 1);
+        song.setRepeats(slot, 1);
+    }
+
+    fixture.project().playState().playSong(0);
+    int switches = 0;
+    int lastPattern = -1;
+    for (int i = 0; i < 40; ++i) {
+        fixture.advance(250);
+        if (trackEngine.pattern() != lastPattern) {
+            lastPattern = trackEngine.pattern();
+            ++switches;
+            expectTrue(matchesRebuild(trackEngine));
+        }
+    }
+    expectTrue(switches >= 3);
+}
+
+}
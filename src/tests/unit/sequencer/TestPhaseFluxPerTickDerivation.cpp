@@ -141,4 +141,23 @@ CASE("non_uniform_durations") {
     expectTrue(nearly(phase, 0.5f), "phase 0.5 halfway through 24-tick stage");
 }
 
+CASE("slot_hint_does_not_change_result") {
+    int cum[17] = { 0 };
+    const int lengths[16] = { 5, 0, 12, 7, 0, 0, 3, 24, 1, 9, 0, 6, 6, 2, 0, 11 };
+    for (int i = 0; i < 16; ++i) cum[i + 1] = cum[i] + lengths[i];
+    for (uint32_t tick = 0; tick < uint32_t(cum[16]) * 2; ++tick) {
+        int slot = -1, cell = -1;
+        float phase = -1.0f;
+        PhaseFluxMath::deriveTickPosition(PhaseFluxMath::snakeOrder(), tick, cum, cum[16], slot, cell, phase);
+        for (int hint = 0; hint < 16; ++hint) {
+            int hintSlot = -1, hintCell = -1;
+            float hintPhase = -1.0f;
+            PhaseFluxMath::deriveTickPosition(PhaseFluxMath::snakeOrder(), tick, cum, cum[16], hintSlot, hintCell, hintPhase, hint);
+            expectEqual(hintSlot, slot, "slot must not depend on the hint");
+            expectEqual(hintCell, cell, "cell must not depend on the hint");
+            expectTrue(hintPhase == phase, "phase must not depend on the hint");
+        }
+    }
+}
+
 }
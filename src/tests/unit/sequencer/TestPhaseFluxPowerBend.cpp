@@ -2,6 +2,7 @@
 
 #include "apps/sequencer/model/PhaseFluxMath.h"
 
+#include <algorithm>
 #include <cmath>
 
 static bool nearly(float a, float b, float eps = 1e-5f) {
@@ -86,4 +87,21 @@ CASE("encoded_endpoints_keep_endpoints") {
     expectTrue(nearly(PhaseFluxMath::powerBend(1.0f, pMin), 1.0f), "y(1,pMin) = 1");
 }
 
+CASE("matches_pow_over_knob_range") {
+    // powerBend runs on lookup tables; it must track std::pow for every
+    // encoded knob value across the whole input range.
+    float maxError = 0.0f;
+    for (int knob = -64; knob <= 64; ++knob) {
+        float p = PhaseFluxMath::powerBendKnobToParam(knob);
+        if (std::fabs(p) >= 1.0f) continue;
+        float exponent = (1.0f - p) / (1.0f + p);
+        for (int i = 1; i < 1024; ++i) {
+            float z = float(i) / 1024.0f;
+            float expected = float(std::pow(double(z), double(exponent)));
+            maxError = std::max(maxError, std::fabs(PhaseFluxMath::powerBend(z, p) - expected));
+        }
+    }
+    expectTrue(maxError < 1e-5f, "powerBend must stay within 1e-5 of std::pow");
+}
+
 }
@@ -5,6 +5,7 @@
 #include "model/Scale.h"
 
 #include <string>
+#include <cstring>
 
 namespace {
 
@@ -30,6 +31,31 @@ bool deserialize(const std::string &text, TeletypeProgram &p) {
     return tt2DeserializeScene(p, readCb, &rb);
 }
 
+bool readBlockCb(void *ctx, void *data, size_t len) {
+    auto *r = static_cast<ReadBuf *>(ctx);
+    if (r->pos + len > r->s->size()) return false;
+    std::memcpy(data, r->s->data() + r->pos, len);
+    r->pos += len;
+    return true;
+}
+
+uint32_t textHash(const std::string &text) {
+    return tt2TextHash(Tt2TextHashSeed, text.data(), text.size());
+}
+
+template<typename Cfg>
+std::string writeImage(const TeletypeProgramT<Cfg> &p, uint32_t hash) {
+    WriteBuf wb;
+    tt2WriteSceneImage(p, hash, writeCb, &wb);
+    return wb.s;
+}
+
+template<typename Cfg>
+bool readImage(const std::string &image, uint32_t hash, TeletypeProgramT<Cfg> &p) {
+    ReadBuf rb{ &image, 0 };
+    return tt2ReadSceneImage(p, hash, readBlockCb, &rb);
+}
+
 // A program exercising every serialized section.
 void buildRepresentative(TeletypeProgram &p) {
     init(p);
@@ -142,4 +168,68 @@ UNIT_TEST("TT2SceneSerializer") {
         expectEqual(int(b.scripts[0].length), 0, "no script lines");
         expectTrue(serialize(a) == serialize(b), "empty round-trips");
     }
+
+    CASE("image_matches_parse") {
+        TeletypeProgram a;
+        buildRepresentative(a);
+        std::string text = serialize(a);
+        TeletypeProgram parsed;
+        expectTrue(deserialize(text, parsed), "deserialize succeeds");
+
+        std::string image = writeImage(parsed, textHash(text));
+        TeletypeProgram loaded;
+        init(loaded);
+        expectTrue(readImage(image, textHash(text), loaded), "image loads");
+        expectTrue(std::memcmp(&loaded, &parsed, sizeof(loaded)) == 0, "image == parsed program");
+        expectTrue(serialize(loaded) == text, "image serializes to the same text");
+    }
+
+    CASE("scene_content_matches_parse") {
+        TeletypeProgram a;
+        buildRepresentative(a);
+        // state the text does not carry
+        a.scripts[0].commands[1].commented = 1;
+        a.patterns[1].idx = 7;
+        a.clockDivisor = 48;
+        a.bootEnabled = 1;
+        a.midiSource.setChannel(5);
+        std::string text = serialize(a);
+        TeletypeProgram parsed;
+        expectTrue(deserialize(text, parsed), "deserialize succeeds");
+
+        TeletypeProgram content;
+        tt2SceneContent(a, content);
+        expectTrue(std::memcmp(&content, &parsed, sizeof(content)) == 0, "scene content == parsed program");
+    }
+
+    CASE("image_rejects_stale_text") {
+        TeletypeProgram a;
+        buildRepresentative(a);
+        std::string text = serialize(a);
+        std::string image = writeImage(a, textHash(text));
+        std::string edited = text + "\n";
+        TeletypeProgram loaded;
+        expectTrue(!readImage(image, textHash(edited), loaded), "hash mismatch -> fall back to parse");
+    }
+
+    CASE("image_rejects_corruption") {
+        TeletypeProgram a;
+        buildRepresentative(a);
+        uint32_t hash = textHash(serialize(a));
+        std::string image = writeImage(a, hash);
+        TeletypeProgram loaded;
+        std::string truncated = image.substr(0, image.size() - 1);
+        expectTrue(!readImage(truncated, hash, loaded), "truncated image rejected");
+        std::string flipped = image;
+        flipped[flipped.size() / 2] ^= 0x01;
+        expectTrue(!readImage(flipped, hash, loaded), "corrupt payload rejected");
+    }
+
+    CASE("image_rejects_other_config") {
+        TeletypeProgram a;
+        buildRepresentative(a);
+        std::string image = writeImage(a, 1234);
+        TeletypeProgramT<TT2ConfigMini> mini;
+        expectTrue(!readImage(image, 1234, mini), "full image not loaded into a mini program");
+    }
 }
@@ -0,0 +1,140 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/ui/TaskTelemetryReporter.h"
+
+#include "core/profiler/TaskTelemetry.h"
+
+#include "os/os.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Sent {
+    uint8_t cable;
+    std::vector<uint8_t> data;
+};
+
+TaskTelemetry::Stats makeStats() {
+    TaskTelemetry::Stats stats = {};
+    stats.sequence = 16385;
+    stats.taskCount = 2;
+    stats.tasks[0] = { "engine", 123, 4096, 1000 };
+    stats.tasks[1] = { "a very long name", 7, 0, 0 };
+    stats.releaseLatency = 42;
+    stats.releaseLatencyMax = 100000;
+    stats.tickBacklog = 3;
+    stats.tickBacklogMax = 200;
+    stats.outputSkew = 4;
+    stats.outputSkewMax = 9;
+    return stats;
+}
+
+} // namespace
+
+UNIT_TEST("TaskTelemetrySysEx") {
+
+    CASE("only telemetry queries are accepted") {
+        TaskTelemetryReporter reporter;
+        const uint8_t other[] = { 0x7d, 0x58, 0x02 };
+        const uint8_t foreign[] = { 0x41, 0x58, 0x01 };
+        const uint8_t query[] = { 0x7d, 0x58, 0x01 };
+        expectFalse(reporter.receive(0, other, sizeof(other)));
+        expectFalse(reporter.receive(0, foreign, sizeof(foreign)));
+        expectFalse(reporter.busy());
+        expectTrue(reporter.receive(0, query, sizeof(query)));
+        expectTrue(reporter.busy());
+    }
+
+    CASE("reply is one header and one message per task, paced one per update") {
+        TaskTelemetryReporter reporter;
+        const uint8_t query[] = { 0x7d, 0x58, 0x01 };
+        reporter.receive(3, query, sizeof(query));
+
+        auto stats = makeStats();
+        std::vector<Sent> sent;
+        auto send = [&] (uint8_t cable, const uint8_t *data, size_t length) {
+            expectTrue(length <= TaskTelemetryReporter::MaxMessageLength);
+            sent.push_back({ cable, std::vector<uint8_t>(data, data + length) });
+            return true;
+        };
+
+        for (int i = 0; i < 5; ++i) {
+            reporter.update(stats, send);
+            expectEqual(int(sent.size()), std::min(i + 1, 3));
+        }
+        expectFalse(reporter.busy());
+
+        const std::vector<uint8_t> header = { 0x7d, 0x58, 0x02, 0x01, 0x00, 0x02, 42, 0x00, 0x7f, 0x7f, 0x03, 0x00, 0x48, 0x01, 0x04, 0x00, 0x09, 0x00 };
+        expectTrue(sent[0].data == header);
+        expectEqual(sent[0].cable, uint8_t(3));
+
+        const std::vector<uint8_t> task0 = { 0x7d, 0x58, 0x03, 0x00, 123, 0x00, 0x00, 0x20, 0x68, 0x07, 'e', 'n', 'g', 'i', 'n', 'e' };
+        expectTrue(sent[1].data == task0);
+
+        const auto &task1 = sent[2].data;
+        expectEqual(int(task1.size()), int(TaskTelemetryReporter::MaxMessageLength));
+        expectEqual(task1[3], uint8_t(1));
+        expectEqual(task1[17], uint8_t('l'));
+    }
+
+    CASE("failed sends are retried and the snapshot is kept") {
+        TaskTelemetryReporter reporter;
+        const uint8_t query[] = { 0x7d, 0x58, 0x01 };
+        reporter.receive(0, query, sizeof(query));
+
+        auto stats = makeStats();
+        bool accept = false;
+        int sentCount = 0;
+        auto send = [&] (uint8_t cable, const uint8_t *data, size_t length) {
+            if (accept) {
+                ++sentCount;
+            }
+            return accept;
+        };
+
+        reporter.update(stats, send);
+        reporter.update(stats, send);
+        expectEqual(sentCount, 0);
+        expectTrue(reporter.busy());
+
+        // changing stats mid reply does not change the task count of the reply
+        stats.taskCount = 8;
+        accept = true;
+        for (int i = 0; i < 10; ++i) {
+            reporter.update(stats, send);
+        }
+        expectEqual(sentCount, 3);
+    }
+
+    CASE("sampled stats report registered tasks and release latency") {
+        os::TaskProfiler::TaskInfo taskInfo("test");
+        TaskTelemetry::resetMax();
+        TaskTelemetry::recordRelease(250);
+        TaskTelemetry::recordRelease(20);
+        TaskTelemetry::recordTickBacklog(5);
+
+        const auto &stats = TaskTelemetry::sample();
+        expectTrue(stats.sequence > 0);
+        expectEqual(stats.releaseLatency, uint32_t(250));
+        expectEqual(stats.releaseLatencyMax, uint32_t(250));
+        expectEqual(stats.tickBacklog, uint32_t(5));
+
+        bool found = false;
+        for (int i = 0; i < stats.taskCount; ++i) {
+            found |= std::string(stats.tasks[i].name) == "test";
+        }
+        expectTrue(found);
+
+        // window latency restarts with each sample, max is kept
+        const auto &next = TaskTelemetry::sample();
+        expectEqual(next.releaseLatency, uint32_t(0));
+        expectEqual(next.releaseLatencyMax, uint32_t(250));
+        expectEqual(next.tickBacklog, uint32_t(0));
+        expectEqual(next.tickBacklogMax, uint32_t(5));
+        expectEqual(TaskTelemetry::stats().sequence, next.sequence);
+    }
+
+}
@@ -0,0 +1,89 @@
+#include "UnitTest.h"
+
+#include "engine/TickCatchUp.h"
+
+#include <algorithm>
+#include <initializer_list>
+
+// The engine runs a frame every 1000 us. Simulate a clock producing ticks at
+// a fixed rate and an engine frame processing as many as the policy allows.
+struct TickSimulation {
+    TickCatchUp catchUp;
+    uint32_t pending = 0;
+    double ticks = 0.0;
+
+    // advance by one frame of the given length, returns the ticks processed
+    uint32_t frame(double ticksPerMs, uint32_t intervalUs) {
+        double next = ticks + ticksPerMs * intervalUs / 1000.0;
+        pending += uint32_t(next) - uint32_t(ticks);
+        ticks = next;
+        uint32_t limit = catchUp.begin(pending, intervalUs, 1000);
+        uint32_t processed = std::min(limit, pending);
+        pending -= processed;
+        return processed;
+    }
+};
+
+UNIT_TEST("TickCatchUp") {
+
+    CASE("burst processes the whole backlog") {
+        TickCatchUp catchUp;
+        catchUp.setPolicy(TickCatchUp::Policy::Burst);
+        expectEqual(catchUp.begin(40, 10000, 1000), TickCatchUp::Unlimited);
+        expectEqual(catchUp.deferred(), uint32_t(0));
+        expectFalse(catchUp.collapse(3));
+    }
+
+    CASE("spread keeps up with the regular tick rate") {
+        for (double ticksPerMs : { 0.1, 0.384, 1.0, 3.2, 6.4 }) {
+            TickSimulation sim;
+            for (int i = 0; i < 1000; ++i) {
+                sim.frame(ticksPerMs, 1000);
+                expectTrue(sim.pending <= 1);
+            }
+        }
+    }
+
+    CASE("spread catches up over a few frames after a late release") {
+        for (double ticksPerMs : { 0.384, 3.2 }) {
+            TickSimulation sim;
+            for (int i = 0; i < 10; ++i) {
+                sim.frame(ticksPerMs, 1000);
+            }
+
+            // engine task delayed by 20 ms
+            uint32_t backlog = sim.pending + uint32_t(ticksPerMs * 20);
+            uint32_t processed = sim.frame(ticksPerMs, 20000);
+            expectTrue(processed < backlog);
+            expectTrue(processed >= 1);
+
+            int frames = 0;
+            while (sim.pending > 1 && frames < 100) {
+                uint32_t before = sim.pending;
+                sim.frame(ticksPerMs, 1000);
+                expectTrue(sim.pending < before);
+                ++frames;
+            }
+            expectTrue(frames <= int(TickCatchUp::SpreadFrames) * 2);
+        }
+    }
+
+    CASE("spread processes ticks left over at slow tempos") {
+        TickCatchUp catchUp;
+        catchUp.setPolicy(TickCatchUp::Policy::Spread);
+        expectEqual(catchUp.begin(0, 1000, 1000), uint32_t(1));
+        expectEqual(catchUp.begin(1, 1000, 1000), uint32_t(1));
+        expectEqual(catchUp.deferred(), uint32_t(0));
+    }
+
+    CASE("collapse processes the backlog and skips all but the last recompute") {
+        TickCatchUp catchUp;
+        catchUp.setPolicy(TickCatchUp::Policy::Collapse);
+        expectEqual(catchUp.begin(5, 5000, 1000), uint32_t(5));
+        expectEqual(catchUp.deferred(), uint32_t(0));
+        expectTrue(catchUp.collapse(4));
+        expectTrue(catchUp.collapse(1));
+        expectFalse(catchUp.collapse(0));
+    }
+
+}
@@ -0,0 +1,149 @@
+#include "UnitTest.h"
+
+#include "apps/sequencer/engine/TimingWheel.h"
+#include "apps/sequencer/engine/SortedQueue.h"
+
+#include <random>
+
+namespace {
+
+struct TimedItem {
+    uint32_t tick;
+    int payload;
+};
+
+struct ByTick {
+    bool operator()(const TimedItem &a, const TimedItem &b) const {
+        return a.tick < b.tick;
+    }
+};
+
+} // anonymous namespace
+
+UNIT_TEST("TimingWheel") {
+
+CASE("push_then_pop_in_tick_order") {
+    TimingWheel<TimedItem, 8, 4> q;
+    expectTrue(q.empty());
+    q.push({ 30, 'C' });
+    q.push({ 10, 'A' });
+    q.push({ 20, 'B' });
+    q.push({ 14, 'D' });   // same bucket as 10 and 30, second lap
+
+    expectEqual(int(q.size()), 4);
+    expectEqual(q.front().payload, int('A'));
+    q.pop();
+    expectEqual(q.front().payload, int('D'));
+    q.pop();
+    expectEqual(q.front().payload, int('B'));
+    q.pop();
+    expectEqual(q.front().payload, int('C'));
+    q.pop();
+    expectTrue(q.empty());
+}
+
+CASE("same_tick_events_keep_push_order") {
+    TimingWheel<TimedItem, 8> q;
+    q.push({ 50, 0xAA });
+    q.push({ 50, 0xBB });
+    q.push({ 40, 0x11 });
+    q.push({ 50, 0xCC });
+
+    expectEqual(q.front().payload, 0x11);
+    q.pop();
+    expectEqual(q.front().payload, 0xAA);
+    q.pop();
+    expectEqual(q.front().payload, 0xBB);
+    q.pop();
+    expectEqual(q.front().payload, 0xCC);
+}
+
+CASE("events far ahead and behind the cursor") {
+    TimingWheel<TimedItem, 8, 4> q;
+    q.push({ 1000, 1 });
+    q.push({ 3, 2 });
+    q.pop();
+    // cursor is at 3 now, push far ahead and before the cursor
+    q.push({ 100, 3 });
+    q.push({ 1, 4 });
+    expectEqual(int(q.front().tick), 1);
+    q.pop();
+    expectEqual(int(q.front().tick), 100);
+    q.pop();
+    expectEqual(int(q.front().tick), 1000);
+}
+
+CASE("overflow_drops_oldest_and_is_counted") {
+    TimingWheel<TimedItem, 4> q;
+    for (int i = 0; i < 6; ++i) {
+        q.push({ uint32_t(10 + i * 10), i });
+    }
+    expectEqual(int(q.size()), 4);
+    expectEqual(int(q.overflows()), 2);
+    expectEqual(int(q.front().tick), 30);
+
+    q.clear();
+    expectTrue(q.empty());
+    expectEqual(int(q.overflows()), 2);
+    q.resetOverflows();
+    expectEqual(int(q.overflows()), 0);
+}
+
+CASE("dense ratchets fit where the sorted queue dropped events") {
+    // 4 ratchets with gate on/off per step, one step ahead queued
+    TimingWheel<TimedItem, 32> q;
+    for (int i = 0; i < 16; ++i) {
+        q.push({ uint32_t(i * 6), 1 });
+        q.push({ uint32_t(i * 6 + 3), 0 });
+    }
+    expectEqual(int(q.size()), 32);
+    expectEqual(int(q.overflows()), 0);
+}
+
+CASE("cancel_after_drops_later_events") {
+    TimingWheel<TimedItem, 16, 4> q;
+    for (int i = 0; i < 10; ++i) {
+        q.push({ uint32_t(i * 3), i });
+    }
+    q.cancelAfter(12);
+    expectEqual(int(q.size()), 5);
+    for (int i = 0; i < 5; ++i) {
+        expectEqual(q.front().payload, i);
+        q.pop();
+    }
+    expectTrue(q.empty());
+}
+
+CASE("matches_sorted_queue_on_random_schedules") {
+    std::mt19937 rng(1234);
+    TimingWheel<TimedItem, 32, 8> wheel;
+    SortedQueue<TimedItem, 64, ByTick> reference;
+    uint32_t tick = 0;
+    int payload = 0;
+    for (int round = 0; round < 20000; ++round) {
+        int action = rng() % 8;
+        if (action < 5 && reference.size() < 31) {
+            TimedItem item = { tick + uint32_t(rng() % 40), payload++ };
+            if (action == 0) {
+                wheel.pushReplace(item);
+                reference.pushReplace(item);
+            } else {
+                wheel.push(item);
+                reference.push(item);
+            }
+        } else {
+            ++tick;
+            while (!reference.empty() && reference.front().tick <= tick) {
+                expectFalse(wheel.empty());
+                expectEqual(wheel.front().tick, reference.front().tick);
+                expectEqual(wheel.front().payload, reference.front().payload);
+                wheel.pop();
+                reference.pop();
+            }
+            expectTrue(wheel.empty() || wheel.front().tick > tick);
+        }
+        expectEqual(wheel.size(), reference.size());
+    }
+}
+
+} // UNIT_TEST("TimingWheel")
@@ -0,0 +1,66 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/TrackEngineDispatch.h"
+
+namespace {
+
+struct ModeVisitor {
+    Track::TrackMode mode = Track::TrackMode::Last;
+    template<typename T> void operator()(T &) { mode = modeOf(static_cast<T *>(nullptr)); }
+
+    static Track::TrackMode modeOf(NoteTrackEngine *) { return Track::TrackMode::Note; }
+    static Track::TrackMode modeOf(CurveTrackEngine *) { return Track::TrackMode::Curve; }
+    static Track::TrackMode modeOf(StochasticTrackEngine *) { return Track::TrackMode::Stochastic; }
+    static Track::TrackMode modeOf(TrackEngine *) { return Track::TrackMode::Last; }
+};
+
+struct OutputVisitor {
+    bool gate;
+    float cv;
+    template<typename T> void operator()(T &trackEngine) {
+        gate = trackEngine.gateOutput(0);
+        cv = trackEngine.cvOutput(0);
+    }
+};
+
+} // namespace
+
+UNIT_TEST("TrackEngineDispatch") {
+
+CASE("visitor receives the concrete engine type") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    fixture.project().setTrackMode(1, Track::TrackMode::Curve);
+    fixture.project().setTrackMode(2, Track::TrackMode::Stochastic);
+    fixture.advance(1);
+
+    for (int trackIndex = 0; trackIndex < 3; ++trackIndex) {
+        auto &trackEngine = fixture.engine().trackEngine(trackIndex);
+        ModeVisitor visitor;
+        visitTrackEngine(trackEngine.trackMode(), trackEngine, visitor);
+        expectTrue(visitor.mode == trackEngine.trackMode());
+    }
+}
+
+CASE("statically dispatched outputs match the virtual interface") {
+    EngineTestFixture fixture;
+    fixture.project().setTrackMode(0, Track::TrackMode::Note);
+    auto &sequence = fixture.project().track(0).noteTrack().sequence(0);
+    for (int step = 0; step < 16; step += 2) {
+        sequence.step(step).setGate(true);
+    }
+    fixture.start();
+
+    auto &trackEngine = fixture.engine().trackEngine(0);
+    for (int i = 0; i < 100; ++i) {
+        fixture.advance(7);
+        OutputVisitor visitor;
+        visitTrackEngine(Track::TrackMode::Note, trackEngine, visitor);
+        expectEqual(visitor.gate, trackEngine.gateOutput(0));
+        expectEqual(visitor.cv, trackEngine.cvOutput(0));
+    }
+}
+
+}
@@ -0,0 +1,243 @@
+#include "UnitTest.h"
+
+#include "engine/TrackOutputComposer.h"
+#include "engine/GateRotation.h"
+#include "engine/Tt2OutputMix.h"
+
+#include <cstring>
+#include <random>
+
+namespace {
+
+constexpr int Channels = TrackOutputComposer::Channels;
+constexpr int Tracks = TrackOutputComposer::Tracks;
+constexpr int Lanes = TrackOutputComposer::CvRouteLanes;
+
+// deterministic random track engine outputs
+struct FakeSource {
+    bool gates[Tracks][Channels];
+    float cvs[Tracks][Channels];
+    float routes[Lanes];
+    int modulator[Channels];    // 0: none, otherwise offset of the modulator in volts * 4
+
+    bool gate(int track, int slot) const { return gates[track][slot]; }
+    float cv(int track, int slot) const { return cvs[track][slot]; }
+    float cvRoute(int lane) const { return routes[lane]; }
+    float applyModulatorOffset(int channel, float cv) const {
+        if (modulator[channel] != 0) {
+            cv += modulator[channel] * 0.25f;
+            cv = clamp(cv, -5.f, 5.f);
+        }
+        return cv;
+    }
+
+    void randomize(std::mt19937 &rng) {
+        std::uniform_real_distribution<float> volts(-6.f, 6.f);
+        for (int t = 0; t < Tracks; ++t) {
+            for (int i = 0; i < Channels; ++i) {
+                gates[t][i] = rng() & 1;
+                cvs[t][i] = volts(rng);
+            }
+        }
+        for (int lane = 0; lane < Lanes; ++lane) {
+            routes[lane] = volts(rng);
+        }
+        for (int i = 0; i < Channels; ++i) {
+            modulator[i] = rng() % 3 == 0 ? int(rng() % 41) - 20 : 0;
+        }
+    }
+};
+
+TrackOutputComposer::Mapping randomMapping(std::mt19937 &rng) {
+    TrackOutputComposer::Mapping mapping;
+    for (int i = 0; i < Channels; ++i) {
+        mapping.gateOutputTracks[i] = rng() % (Tracks + 2);
+        mapping.cvOutputTracks[i] = rng() % (Tracks + 2);
+    }
+    mapping.tt2Tracks = rng() % 4 == 0 ? (rng() & 0xff) : 0;
+    mapping.gateRotateMask = rng() & 0xff;
+    mapping.cvRotateMask = rng() & 0xff;
+    mapping.gateRotateAmount = int(rng() % 17) - 8;
+    mapping.cvRotateAmount = int(rng() % 17) - 8;
+    return mapping;
+}
+
+// per-channel composition as done by Engine::updateTrackOutputs() before the composer
+void referenceCompose(const TrackOutputComposer::Mapping &mapping, const FakeSource &source, uint8_t &gates, float *cv) {
+    bool isTt2[Tracks];
+    bool anyTt2 = false;
+    for (int t = 0; t < Tracks; ++t) {
+        isTt2[t] = mapping.tt2Tracks & (1 << t);
+        anyTt2 = anyTt2 || isTt2[t];
+    }
+
+    int trackGateIndex[Tracks] = {};
+    int trackCvIndex[Tracks] = {};
+    int cvOutputTrackSlot[Channels];
+    int cvOutputCvRouteLane[Channels];
+    for (int i = 0; i < Channels; ++i) {
+        cvOutputTrackSlot[i] = -1;
+        cvOutputCvRouteLane[i] = -1;
+    }
+
+    int gatePool[Channels];
+    int gatePoolSize = 0;
+    for (int i = 0; i < Channels; ++i) {
+        int trackIndex = mapping.gateOutputTracks[i];
+        if (trackIndex < Tracks && !isTt2[trackIndex] && (mapping.gateRotateMask & (1 << trackIndex))) {
+            gatePool[gatePoolSize++] = i;
+        }
+    }
+
+    int cvPool[Channels];
+    int cvPoolSize = 0;
+    for (int i = 0; i < Channels; ++i) {
+        int trackIndex = mapping.cvOutputTracks[i];
+        if (trackIndex < Tracks && !isTt2[trackIndex] && (mapping.cvRotateMask & (1 << trackIndex))) {
+            cvPool[cvPoolSize++] = i;
+        }
+    }
+
+    int cvRouteLane = 0;
+    for (int i = 0; i < Channels; ++i) {
+        int trackIndex = mapping.cvOutputTracks[i];
+        if (trackIndex < Tracks) {
+            cvOutputTrackSlot[i] = trackCvIndex[trackIndex]++;
+        } else if (trackIndex == Tracks) {
+            cvOutputCvRouteLane[i] = cvRouteLane++;
+        }
+    }
+
+    for (int i = 0; i < Channels; ++i) {
+        int gateSourceOutputIndex = i;
+        for (int k = 0; k < gatePoolSize; ++k) {
+            if (gatePool[k] == i) {
+                gateSourceOutputIndex = gatePool[rotatedGroupMember(k, mapping.gateRotateAmount, gatePoolSize)];
+                break;
+            }
+        }
+        int gateOutputTrack = mapping.gateOutputTracks[gateSourceOutputIndex];
+        if (gateOutputTrack < Tracks) {
+            bool g = isTt2[gateOutputTrack] ? false : source.gate(gateOutputTrack, trackGateIndex[gateOutputTrack]++);
+            bool gateAtJack[Tracks];
+            for (int t = 0; t < Tracks; ++t) {
+                gateAtJack[t] = isTt2[t] ? source.gate(t, i) : false;
+            }
+            g = g || Tt2OutputMix::anyGate(gateAtJack, isTt2, Tracks);
+            gates = g ? (gates | (1 << i)) : (gates & ~(1 << i));
+        }
+
+        int cvSourceOutputIndex = i;
+        for (int k = 0; k < cvPoolSize; ++k) {
+            if (cvPool[k] == i) {
+                cvSourceOutputIndex = cvPool[rotatedGroupMember(k, mapping.cvRotateAmount, cvPoolSize)];
+                break;
+            }
+        }
+        int cvOutputTrack = mapping.cvOutputTracks[cvSourceOutputIndex];
+        float cvBase = 0.f;
+        bool writeJack = anyTt2;
+        if (cvOutputTrack < Tracks) {
+            if (!isTt2[cvOutputTrack]) {
+                cvBase = source.cv(cvOutputTrack, cvOutputTrackSlot[cvSourceOutputIndex]);
+            }
+            writeJack = true;
+        } else if (cvOutputTrack == Tracks) {
+            int lane = cvOutputCvRouteLane[cvSourceOutputIndex];
+            if (lane >= 0 && lane < Lanes) {
+                cvBase = source.cvRoute(lane);
+                writeJack = true;
+            }
+        }
+        if (writeJack) {
+            float v = source.applyModulatorOffset(i, cvBase);
+            float cvAtJack[Tracks];
+            for (int t = 0; t < Tracks; ++t) {
+                cvAtJack[t] = isTt2[t] ? source.cv(t, i) : 0.f;
+            }
+            cv[i] = clamp(v + Tt2OutputMix::sumCv(cvAtJack, isTt2, Tracks), -5.f, 5.f);
+        }
+    }
+}
+
+} // namespace
+
+UNIT_TEST("TrackOutputComposer") {
+
+CASE("default layout maps track outputs in order") {
+    TrackOutputComposer composer;
+    TrackOutputComposer::Mapping mapping = {};
+    for (int i = 0; i < Channels; ++i) {
+        mapping.gateOutputTracks[i] = i;
+        mapping.cvOutputTracks[i] = i;
+    }
+    composer.setMapping(mapping);
+
+    FakeSource source = {};
+    for (int t = 0; t < Tracks; ++t) {
+        source.gates[t][0] = t % 2;
+        source.cvs[t][0] = t * 0.5f;
+    }
+    uint8_t gates = composer.composeGates(source, 0);
+    float cv[Channels] = {};
+    composer.composeCv(source, cv);
+    expectEqual(int(gates), 0xaa);
+    for (int i = 0; i < Channels; ++i) {
+        expectEqual(cv[i], i * 0.5f);
+    }
+}
+
+CASE("unmapped jacks keep their values") {
+    TrackOutputComposer composer;
+    TrackOutputComposer::Mapping mapping = {};
+    for (int i = 0; i < Channels; ++i) {
+        mapping.gateOutputTracks[i] = Tracks;
+        mapping.cvOutputTracks[i] = Tracks + 1;
+    }
+    composer.setMapping(mapping);
+
+    FakeSource source = {};
+    float cv[Channels];
+    for (int i = 0; i < Channels; ++i) {
+        cv[i] = 1.f;
+    }
+    expectEqual(int(composer.composeGates(source, 0x5a)), 0x5a);
+    composer.composeCv(source, cv);
+    for (int i = 0; i < Channels; ++i) {
+        expectEqual(cv[i], 1.f);
+    }
+}
+
+CASE("matches per-channel composition bit for bit") {
+    std::mt19937 rng(1234);
+    TrackOutputComposer composer;
+    FakeSource source;
+    for (int iteration = 0; iteration < 20000; ++iteration) {
+        // keep the mapping for a few frames to exercise the cached plan
+        if (iteration % 4 == 0) {
+            composer.setMapping(randomMapping(rng));
+        }
+        source.randomize(rng);
+
+        uint8_t initialGates = rng() & 0xff;
+        float initialCv[Channels];
+        for (int i = 0; i < Channels; ++i) {
+            initialCv[i] = float(i) - 3.5f;
+        }
+
+        uint8_t expectedGates = initialGates;
+        float expectedCv[Channels];
+        std::memcpy(expectedCv, initialCv, sizeof(expectedCv));
+        referenceCompose(composer.mapping(), source, expectedGates, expectedCv);
+
+        uint8_t gates = composer.composeGates(source, initialGates);
+        float cv[Channels];
+        std::memcpy(cv, initialCv, sizeof(cv));
+        composer.composeCv(source, cv);
+
+        expectEqual(int(gates), int(expectedGates));
+        expectTrue(std::memcmp(cv, expectedCv, sizeof(cv)) == 0, "cv bits");
+    }
+}
+
+}
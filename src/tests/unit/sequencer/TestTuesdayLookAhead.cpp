@@ -0,0 +1,135 @@
+#include "UnitTest.h"
+
+#include "EngineTestFixture.h"
+
+#include "apps/sequencer/engine/TuesdayTrackEngine.h"
+#include "apps/sequencer/model/TuesdayTrack.h"
+#include "apps/sequencer/Config.h"
+
+#include <algorithm>
+#include <vector>
+
+// The tuesday engine generates steps ahead of their tick. Every run is compared
+// against one generating each step on its own tick: the outputs must match,
+// including across sequence edits, reseeds and routed parameter changes that
+// land while steps are queued.
+
+namespace {
+
+enum class Edit {
+    None,
+    Transpose,
+    Power,
+    Reseed,
+    RoutedTranspose,
+    RoutedPower,
+};
+
+struct Capture {
+    std::vector<float> cv;
+    std::vector<bool> gate;
+    int maxLookAhead = 0;
+};
+
+Capture run(int algorithm, Edit edit, bool lookAhead) {
+    EngineTestFixture fixture(true);
+    auto &project = fixture.project();
+    project.setTempo(200.f);
+    project.routing().clear();
+    for (int trackIndex = 1; trackIndex < CONFIG_TRACK_COUNT; ++trackIndex) {
+        project.setTrackMode(trackIndex, Track::TrackMode::Note);
+    }
+
+    project.setTrackMode(0, Track::TrackMode::Tuesday);
+    auto &sequence = project.track(0).tuesdayTrack().sequence(0);
+    sequence.setAlgorithm(algorithm);
+    sequence.setFlow(7);
+    sequence.setOrnament(5);
+    sequence.setPower(12);
+    sequence.setLoopLength(16);
+    sequence.setDivisor(12);
+
+    if (edit == Edit::RoutedTranspose || edit == Edit::RoutedPower) {
+        auto &route = project.routing().route(0);
+        route.setSource(Routing::Source::CvIn1);
+        route.setTarget(edit == Edit::RoutedTranspose ? Routing::Target::Transpose : Routing::Target::Power);
+        route.setTracks(0x01);
+        fixture.setCvIn(0, 0.f);
+    }
+
+    Capture capture;
+    auto &engine = fixture.engine();
+    fixture.setUpdateHooks(nullptr, [&] {
+        capture.cv.push_back(engine.trackEngine(0).cvOutput(0));
+        capture.gate.push_back(engine.trackEngine(0).gateOutput(0));
+    });
+    fixture.start();
+    fixture.advance(1);
+
+    auto &tuesdayEngine = engine.trackEngine(0).as<TuesdayTrackEngine>();
+    tuesdayEngine.setLookAheadEnabledForTest(lookAhead);
+
+    for (int ms = 0; ms < 3000; ++ms) {
+        if (ms == 1237) {
+            switch (edit) {
+            case Edit::None:        break;
+            case Edit::Transpose:   sequence.setTranspose(5); break;
+            case Edit::Power:       sequence.setPower(4); break;
+            case Edit::Reseed:      tuesdayEngine.reseed(); break;
+            case Edit::RoutedTranspose:
+            case Edit::RoutedPower: fixture.setCvIn(0, 4.f); break;
+            }
+        }
+        fixture.advance(1);
+        capture.maxLookAhead = std::max(capture.maxLookAhead, tuesdayEngine.lookAheadCountForTest());
+    }
+    return capture;
+}
+
+void expectMatchesReference(int algorithm, Edit edit) {
+    auto ahead = run(algorithm, edit, true);
+    auto reference = run(algorithm, edit, false);
+
+    expectTrue(ahead.maxLookAhead > 0, "steps are generated ahead");
+    expectEqual(reference.maxLookAhead, 0, "reference generates on the tick");
+    expectEqual(ahead.cv.size(), reference.cv.size(), "frame count");
+
+    int gates = 0;
+    int cvMismatches = 0;
+    int gateMismatches = 0;
+    for (size_t i = 0; i < reference.cv.size() && i < ahead.cv.size(); ++i) {
+        gates += reference.gate[i] ? 1 : 0;
+        cvMismatches += ahead.cv[i] != reference.cv[i] ? 1 : 0;
+        gateMismatches += ahead.gate[i] != reference.gate[i] ? 1 : 0;
+    }
+    expectTrue(gates > 0, "track produces gates");
+    expectEqual(cvMismatches, 0, "cv matches generation on the tick");
+    expectEqual(gateMismatches, 0, "gates match generation on the tick");
+}
+
+} // namespace
+
+UNIT_TEST("TuesdayLookAhead") {
+
+CASE("queued steps match generation on the tick") {
+    for (int algorithm : { 0, 1, 3, 6, 10 }) {
+        expectMatchesReference(algorithm, Edit::None);
+    }
+}
+
+CASE("sequence edits invalidate queued steps") {
+    expectMatchesReference(1, Edit::Transpose);
+    expectMatchesReference(15, Edit::Power);
+}
+
+CASE("reseed invalidates queued steps") {
+    expectMatchesReference(1, Edit::Reseed);
+    expectMatchesReference(3, Edit::Reseed);
+}
+
+CASE("routed changes invalidate queued steps") {
+    expectMatchesReference(3, Edit::RoutedTranspose);
+    expectMatchesReference(15, Edit::RoutedPower);
+}
+
+}